@@ -6,6 +6,8 @@
 #include "main.h"
 #include "board.h"
 #include "scheduler.h"
+#include "sched_queue.h"
+#include "sched_trace.h"
 #include "uart_driver.h"
 #include "hylink_parser.h"
 #include "version.h"
@@ -13,45 +15,67 @@
 #include <stdio.h>
 #include <string.h>
 
-/* CMSIS头文件用于__WFI */
-#if defined(STM32H743xx)
-    #include "stm32h7xx.h"
-#elif defined(STM32F407xx)
-    #include "stm32f4xx.h"
-#endif
-
 /* ========================================================================
  * 全局变量
  * ======================================================================== */
 
-/* 最近收到的数据包 */
-static hylink_packet_t g_last_packet;
-static volatile bool   g_packet_received = false;
+/* 接收数据包队列 (中断 -> HYlink处理任务), 队列项为缓冲池槽位指针;
+ * 深度与缓冲池相同, 丢包只发生在缓冲池耗尽处 (hylink_pool_stats_t.exhausted) */
+#define HYLINK_RX_QUEUE_DEPTH  HYLINK_POOL_SIZE
+
+static const hylink_packet_t *g_packet_queue_buf[HYLINK_RX_QUEUE_DEPTH];
+static sched_queue_t          g_packet_queue;
+
+/* 内核事件跟踪中的 UART 接收中断编号 */
+#define TRACE_IRQ_UART_RX      1
 
-/* 解析统计 */
+/* 本次 UART 中断中是否唤醒了更高优先级任务 (中断退出前统一切换) */
+static bool g_rx_task_woken;
+
+/* 解析与缓冲池统计 */
 static hylink_parser_stats_t g_stats;
+static hylink_pool_stats_t   g_pool_stats;
+
+#if SCHED_RUNTIME_STATS
+/* 任务运行时间统计 (调试器可直接查看) */
+static sched_task_runtime_t    g_task_runtime[SCHED_MAX_TASKS];
+static uint32_t                g_task_runtime_count;
+static sched_runtime_summary_t g_runtime_prev;
+static uint16_t                g_cpu_load_pct10;  /* 最近统计周期的 CPU 负载 (0.1%) */
+#endif
 
 /* ========================================================================
  * HYlink回调函数
  * ======================================================================== */
 
 /**
- * HYlink数据包接收回调
+ * HYlink数据包接收回调 (UART中断上下文)
  */
 void on_hylink_packet_received(const hylink_packet_t *packet)
 {
-    /* 拷贝数据包(因为packet仅在回调期间有效) */
-    memcpy(&g_last_packet, packet, sizeof(hylink_packet_t));
-    g_packet_received = true;
+    /* 持有一个引用后把槽位指针交给处理任务 (不拷贝包内容), 队列满时放弃 */
+    if (!hylink_pool_ref(packet)) {
+        return;
+    }
+    if (!sched_queue_send_from_isr(&g_packet_queue, &packet, &g_rx_task_woken)) {
+        hylink_pool_release(packet);
+    }
 }
 
 /**
- * UART数据接收回调
+ * UART数据接收回调 (UART中断上下文)
  */
 void on_uart_data_received(const uint8_t *data, uint16_t len)
 {
-    /* 喂给HYlink解析器 */
+    sched_trace_isr_enter(TRACE_IRQ_UART_RX);
+    g_rx_task_woken = false;
+
+    /* 喂给HYlink解析器, 一批数据可能解析出多个数据包 */
     hylink_parser_feed(data, len);
+
+    /* 无论唤醒几次, 中断退出后只切换一次 */
+    sched_yield_from_isr(g_rx_task_woken);
+    sched_trace_isr_exit(TRACE_IRQ_UART_RX);
 }
 
 /* ========================================================================
@@ -80,19 +104,16 @@ void task_hylink_handler(void *param)
 {
     (void)param;
 
+    const hylink_packet_t *packet;
+
     while (1) {
-        if (g_packet_received) {
-            /* 临界区保护 */
-            sched_enter_critical();
-            hylink_packet_t packet = g_last_packet;
-            g_packet_received = false;
-            sched_exit_critical();
-
-            /* LED2短暂点亮表示收到数据包 */
-            board_led_set(BOARD_LED_2, LED_ON);
-
-            /* 处理不同类型的数据包 */
-            switch (packet.header.cmd) {
+        /* 阻塞等待数据包, 到达后立即被唤醒 */
+        if (sched_queue_receive(&g_packet_queue, &packet, SCHED_WAIT_FOREVER)) {
+            /* LED2翻转表示收到数据包 */
+            board_led_toggle(BOARD_LED_2);
+
+            /* 处理不同类型的数据包 (直接读取缓冲池槽位) */
+            switch (packet->header.cmd) {
                 case CMD_HEARTBEAT:
                     /* 心跳包 */
                     break;
@@ -110,11 +131,9 @@ void task_hylink_handler(void *param)
                     break;
             }
 
-            sched_delay(50);
-            board_led_set(BOARD_LED_2, LED_OFF);
+            /* 处理完毕归还槽位 */
+            hylink_pool_release(packet);
         }
-
-        sched_delay(10);  /* 每10ms检查一次 */
     }
 }
 
@@ -129,6 +148,7 @@ void task_statistics(void *param)
     while (1) {
         /* 获取统计信息 */
         hylink_parser_get_stats(&g_stats);
+        hylink_pool_get_stats(&g_pool_stats);
 
         /* LED3闪烁表示统计输出 */
         board_led_toggle(BOARD_LED_3);
@@ -136,6 +156,23 @@ void task_statistics(void *param)
         /* 这里可以通过RTT或其他方式输出统计信息 */
         /* SEGGER_RTT_printf(0, "HYlink Stats: Total=%lu, CRC_Err=%lu, Hdr_Err=%lu\n",
                            g_stats.total_packets, g_stats.crc_errors, g_stats.header_errors); */
+        /* SEGGER_RTT_printf(0, "HYlink Pool: Exhausted=%lu, BadRef=%lu, BadRelease=%lu, Free=%u, MinFree=%u\n",
+                           g_pool_stats.exhausted, g_pool_stats.bad_refs, g_pool_stats.bad_releases,
+                           g_pool_stats.free, g_pool_stats.min_free); */
+
+#if SCHED_RUNTIME_STATS
+        /* 任务运行时间: 与上次快照相减得到本统计周期的 CPU 负载 */
+        sched_runtime_summary_t summary;
+        g_task_runtime_count = sched_get_runtime_stats(g_task_runtime, SCHED_MAX_TASKS, &summary);
+
+        uint64_t elapsed = summary.elapsed - g_runtime_prev.elapsed;
+        uint64_t busy = summary.busy - g_runtime_prev.busy;
+        g_cpu_load_pct10 = elapsed ? (uint16_t)(busy * 1000U / elapsed) : 0;
+        g_runtime_prev = summary;
+
+        /* SEGGER_RTT_printf(0, "CPU load: %u.%u%%\n", g_cpu_load_pct10 / 10U, g_cpu_load_pct10 % 10U); */
+        /* 各任务启动以来的占比见 g_task_runtime[0 .. g_task_runtime_count - 1].run_time / g_runtime_prev.elapsed */
+#endif
 
         sched_delay(2000);  /* 每2秒统计一次 */
     }
@@ -190,7 +227,7 @@ void task_idle(void *param)
     (void)param;
 
     while (1) {
-        __WFI();  /* 进入低功耗模式 */
+        sched_idle_sleep();  /* 进入低功耗模式 (无滴答模式下睡眠到下一个任务到期) */
     }
 }
 
@@ -207,7 +244,9 @@ int main(void)
     /* 打印固件版本信息 */
     version_print();
 
-    /* 2. 初始化HYlink解析器 */
+    /* 2. 初始化数据包队列与HYlink解析器 */
+    sched_queue_init(&g_packet_queue, g_packet_queue_buf,
+                     sizeof(g_packet_queue_buf[0]), HYLINK_RX_QUEUE_DEPTH);
     hylink_parser_init(on_hylink_packet_received);
 
     /* 3. 初始化UART (230400波特率) */
@@ -221,6 +260,7 @@ int main(void)
 
     /* 4. 初始化调度器 */
     sched_init();
+    sched_trace_isr_name(TRACE_IRQ_UART_RX, "UART_RX");
 
     /* 5. 创建任务 */
     sched_task_create(
@@ -234,7 +274,7 @@ int main(void)
     sched_task_create(
         task_hylink_handler,
         "HYlink_Handler",
-        1024,
+        512,   /* 包内容留在缓冲池, 栈上只有槽位指针 */
         NULL,
         6  /* 高优先级 - 处理协议数据 */
     );
@@ -0,0 +1,101 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "board.h"
+#include "board_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static struct timespec boot_time;
+
+#if defined(SCHED_TRACE) && SCHED_TRACE
+void board_rtt_host_init(void);  /* rtt_host.c */
+#endif
+
+void board_init(void)
+{
+    clock_gettime(CLOCK_MONOTONIC, &boot_time);
+
+    /* stdout 可能是管道，按行刷新便于实时观察任务输出 */
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+#if defined(SCHED_TRACE) && SCHED_TRACE
+    /* 内核事件跟踪：RTT 通道写入 SCHED_TRACE_FILE */
+    board_rtt_host_init();
+#endif
+}
+
+void board_delay_ms(uint32_t ms)
+{
+    struct timespec ts = {
+        .tv_sec  = (time_t)(ms / 1000U),
+        .tv_nsec = (long)(ms % 1000U) * 1000000L
+    };
+
+    nanosleep(&ts, NULL);
+}
+
+uint32_t board_millis(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t)((now.tv_sec - boot_time.tv_sec) * 1000L +
+                      (now.tv_nsec - boot_time.tv_nsec) / 1000000L);
+}
+
+/* 模拟 LED：只记录状态 */
+static uint8_t led_state[BOARD_LED_MAX] = {0};
+
+void board_led_init(void)
+{
+    for (size_t i = 0; i < BOARD_LED_MAX; i++) {
+        board_led_set((board_led_id_t)i, LED_OFF);
+    }
+}
+
+void board_led_set(board_led_id_t led, led_state_t state)
+{
+    if (led >= BOARD_LED_MAX) {
+        return;
+    }
+
+#if BOARD_POSIX_LED_TRACE
+    if (led_state[led] != (uint8_t)state) {
+        printf("[LED%u] %s\n", (unsigned)led + 1U, state ? "ON" : "OFF");
+    }
+#endif
+
+    led_state[led] = (uint8_t)state;
+}
+
+void board_led_toggle(board_led_id_t led)
+{
+    if (led >= BOARD_LED_MAX) {
+        return;
+    }
+
+    board_led_set(led, led_state[led] ? LED_OFF : LED_ON);
+}
+
+/* 错误信息存储（用于调试） */
+static volatile board_error_info_t last_error = {0};
+
+void board_error_handler(const char *file, uint32_t line, const char *func)
+{
+    /* 记录错误信息 */
+    last_error.file = file;
+    last_error.line = line;
+    last_error.func = func;
+
+    fprintf(stderr, "[board] error at %s:%lu (%s)\n", file, (unsigned long)line, func);
+    board_fatal_halt();
+}
+
+void board_fatal_halt(void)
+{
+    /* 主机上直接终止进程，便于调试器/CI 捕获 */
+    fflush(stdout);
+    abort();
+}
@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file    board_config.h
+ * @brief   POSIX host simulation board configuration header
+ ******************************************************************************
+ */
+
+#ifndef __BOARD_CONFIG_H
+#define __BOARD_CONFIG_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Board specific defines */
+#define BOARD_POSIX       1
+#define BOARD_HAS_LED     1
+
+/* LED 状态变化时打印到 stdout (默认关闭，避免刷屏) */
+#ifndef BOARD_POSIX_LED_TRACE
+#define BOARD_POSIX_LED_TRACE  0
+#endif
+
+/* UART 发送写入的文件描述符，-1 表示丢弃 (stdout 留给 printf) */
+#ifndef BOARD_POSIX_UART_TX_FD
+#define BOARD_POSIX_UART_TX_FD  (-1)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __BOARD_CONFIG_H */
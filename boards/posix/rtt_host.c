@@ -0,0 +1,99 @@
+/**
+ * @file    rtt_host.c
+ * @brief   POSIX 主机仿真 RTT 读取 (代替 J-Link 读取内核事件跟踪通道)
+ * @note    仅在 SCHED_TRACE=1 时编译
+ *
+ * 实现说明：
+ * - 环境变量 SCHED_TRACE_FILE 指定输出文件，未设置时不启动读取线程
+ *   (缓冲区写满后跟踪事件按丢弃计数，与未连接调试器的硬件行为一致)
+ * - 读取线程每毫秒把跟踪通道的数据追加到文件，进程退出时再读空一次
+ * - 例如：SCHED_TRACE_FILE=trace.bin ./sched_bench_posix
+ *         python3 tools/sched_trace.py trace.bin -o trace.json
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "board.h"
+
+#if defined(SCHED_TRACE) && SCHED_TRACE
+
+/* <sched.h> (经 pthread.h 引入) 的 sched_yield 与调度器 API 同名，包含系统头时改名 */
+#define sched_yield posix_sched_yield
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#undef sched_yield
+
+#include "sched_trace.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 私有变量
+ * ======================================================================== */
+
+static FILE            *trace_file = NULL;
+static pthread_mutex_t  trace_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* ========================================================================
+ * 私有函数
+ * ======================================================================== */
+
+/**
+ * 读空跟踪通道并写入文件
+ */
+static void rtt_host_drain(void)
+{
+    uint8_t  chunk[1024];
+    unsigned len;
+
+    pthread_mutex_lock(&trace_lock);
+    while ((len = SEGGER_RTT_ReadUpBufferNoLock(SCHED_TRACE_RTT_CHANNEL, chunk, sizeof(chunk))) > 0) {
+        fwrite(chunk, 1, len, trace_file);
+    }
+    fflush(trace_file);
+    pthread_mutex_unlock(&trace_lock);
+}
+
+static void *rtt_host_thread(void *arg)
+{
+    (void)arg;
+
+    const struct timespec period = { .tv_sec = 0, .tv_nsec = 1000000L };
+
+    while (1) {
+        rtt_host_drain();
+        nanosleep(&period, NULL);
+    }
+
+    return NULL;
+}
+
+/* ========================================================================
+ * 公共 API 实现
+ * ======================================================================== */
+
+/**
+ * 启动跟踪读取线程 (board_init 调用)
+ */
+void board_rtt_host_init(void)
+{
+    const char *path = getenv("SCHED_TRACE_FILE");
+    if (path == NULL || path[0] == '\0') {
+        return;
+    }
+
+    trace_file = fopen(path, "wb");
+    if (trace_file == NULL) {
+        perror("SCHED_TRACE_FILE");
+        return;
+    }
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, rtt_host_thread, NULL);
+    pthread_detach(thread);
+
+    atexit(rtt_host_drain);
+}
+
+#endif /* SCHED_TRACE */
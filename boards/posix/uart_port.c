@@ -0,0 +1,154 @@
+/**
+ * @file    uart_port.c
+ * @brief   POSIX 主机仿真 UART 实现
+ * @note    RX 来自 stdin，TX 写入 BOARD_POSIX_UART_TX_FD (默认丢弃)
+ *
+ * 实现说明：
+ * - 接收线程阻塞读取 stdin，数据放入环形缓冲区后挂起模拟中断
+ * - 中断处理函数 (中断上下文) 取出缓冲区数据交给接收回调，
+ *   与 STM32 上 "DMA 循环接收 + 空闲中断" 的调用方式一致
+ * - 例如回放抓包数据：./EmbeddedTemplate < capture.bin
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "uart_driver.h"
+#include "board_config.h"
+#include "port_posix.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* ========================================================================
+ * 配置参数
+ * ======================================================================== */
+
+#define UART_RX_BUFFER_SIZE  1024    /* 接收环形缓冲区大小 */
+#define UART_RX_CHUNK_SIZE   256     /* 接收线程单次读取 / 中断单次回调的最大字节数 */
+
+/* ========================================================================
+ * 私有变量
+ * ======================================================================== */
+
+static uint8_t            rx_buffer[UART_RX_BUFFER_SIZE];  /* 接收缓冲区 */
+static uint16_t           rx_head = 0;                     /* 写位置 (接收线程) */
+static uint16_t           rx_tail = 0;                     /* 读位置 (中断) */
+static pthread_mutex_t    rx_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t     rx_space = PTHREAD_COND_INITIALIZER;
+static uart_rx_callback_t rx_callback = NULL;              /* 接收回调 */
+static int                rx_irq = -1;                     /* 模拟中断号 */
+
+/* ========================================================================
+ * 私有函数
+ * ======================================================================== */
+
+static uint16_t rx_used(void)
+{
+    return (uint16_t)((rx_head + UART_RX_BUFFER_SIZE - rx_tail) % UART_RX_BUFFER_SIZE);
+}
+
+/**
+ * UART 接收中断处理 (模拟中断上下文)
+ */
+static void uart_rx_isr(void)
+{
+    uint8_t  chunk[UART_RX_CHUNK_SIZE];
+    uint16_t len;
+
+    do {
+        pthread_mutex_lock(&rx_lock);
+        len = 0;
+        while (len < UART_RX_CHUNK_SIZE && rx_tail != rx_head) {
+            chunk[len++] = rx_buffer[rx_tail];
+            rx_tail = (uint16_t)((rx_tail + 1U) % UART_RX_BUFFER_SIZE);
+        }
+        pthread_cond_signal(&rx_space);
+        pthread_mutex_unlock(&rx_lock);
+
+        if (len > 0 && rx_callback) {
+            rx_callback(chunk, len);
+        }
+    } while (len == UART_RX_CHUNK_SIZE);
+}
+
+/**
+ * 接收线程：读取 stdin 并挂起接收中断 (缓冲区满时等待中断取走数据，不丢字节)
+ */
+static void* uart_rx_thread(void *arg)
+{
+    (void)arg;
+
+    uint8_t chunk[UART_RX_CHUNK_SIZE];
+
+    while (1) {
+        ssize_t n = read(STDIN_FILENO, chunk, sizeof(chunk));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;  /* EOF 或错误：停止接收 */
+        }
+
+        for (ssize_t i = 0; i < n; i++) {
+            pthread_mutex_lock(&rx_lock);
+            while (rx_used() == UART_RX_BUFFER_SIZE - 1U) {
+                port_posix_trigger_interrupt(rx_irq);
+                pthread_cond_wait(&rx_space, &rx_lock);
+            }
+            rx_buffer[rx_head] = chunk[i];
+            rx_head = (uint16_t)((rx_head + 1U) % UART_RX_BUFFER_SIZE);
+            pthread_mutex_unlock(&rx_lock);
+        }
+
+        port_posix_trigger_interrupt(rx_irq);
+    }
+
+    return NULL;
+}
+
+/* ========================================================================
+ * 公共接口实现（实现 uart_driver.h）
+ * ======================================================================== */
+
+bool uart_init(uint32_t baudrate, uart_rx_callback_t callback)
+{
+    (void)baudrate;
+
+    if (!callback) {
+        return false;
+    }
+
+    rx_callback = callback;
+    rx_head = 0;
+    rx_tail = 0;
+
+    rx_irq = port_posix_register_interrupt(uart_rx_isr);
+    if (rx_irq < 0) {
+        return false;
+    }
+
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, uart_rx_thread, NULL) != 0) {
+        return false;
+    }
+    pthread_detach(thread);
+
+    return true;
+}
+
+uint16_t uart_send(const uint8_t *data, uint16_t len)
+{
+#if BOARD_POSIX_UART_TX_FD >= 0
+    ssize_t n = write(BOARD_POSIX_UART_TX_FD, data, len);
+    return (n > 0) ? (uint16_t)n : 0;
+#else
+    (void)data;
+    return len;
+#endif
+}
+
+bool uart_is_ready(void)
+{
+    return rx_callback != NULL;
+}
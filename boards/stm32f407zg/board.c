@@ -7,7 +7,15 @@ static void SystemClock_Config(void);
 void board_init(void)
 {
     HAL_Init();
-    SystemClock_Config();
+
+    if (BOARD_QEMU) {
+        /* QEMU 中 PLL 永远不会锁定：保持复位时钟，按模型频率重新配置滴答 */
+        SystemCoreClock = BOARD_QEMU_SYSCLK_HZ;
+        HAL_InitTick(TICK_INT_PRIORITY);
+    } else {
+        SystemClock_Config();
+    }
+
     HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
 }
 
@@ -72,6 +80,14 @@ uint32_t board_millis(void)
     return HAL_GetTick();
 }
 
+/* HAL 时基：SysTick 由调度器接管时经移植层调用，保证 HAL_Delay/超时正常推进 */
+void board_tick_hook(uint32_t ticks)
+{
+    while (ticks--) {
+        HAL_IncTick();
+    }
+}
+
 /* LED 硬件映射表 */
 typedef struct {
     GPIO_TypeDef *port;
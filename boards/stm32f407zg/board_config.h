@@ -34,6 +34,12 @@ extern "C"
 /* LED 极性：1=高电平点亮，0=低电平点亮 */
 #define BOARD_LED_ACTIVE_HIGH 1
 
+/* QEMU netduinoplus2 (STM32F405) 运行：不模拟 RCC/PLL，跳过时钟配置 */
+#ifndef BOARD_QEMU
+#define BOARD_QEMU 0
+#endif
+#define BOARD_QEMU_SYSCLK_HZ  168000000U  /* QEMU 模型的 SYSCLK (SysTick 时钟) */
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,6 +7,7 @@
 
 #include "stm32f4xx_it.h"
 #include "stm32f4xx_hal.h"
+#include "board.h"
 
 /**
   * @brief This function handles Non maskable interrupt.
@@ -28,8 +29,9 @@ void HardFault_Handler(void)
 
 /**
   * @brief This function handles Memory management fault.
+  * @note  弱定义：开启 SCHED_MPU_STACK_GUARD 时由移植层 (port.c) 的实现接管
   */
-void MemManage_Handler(void)
+__weak void MemManage_Handler(void)
 {
   while (1) {
   }
@@ -69,15 +71,18 @@ void SVC_Handler(void)
 
 /**
   * @brief This function handles PendSV exception.
+  * @note  弱定义：链接调度器时由移植层 (port.c) 的实现接管
   */
-void PendSV_Handler(void)
+__weak void PendSV_Handler(void)
 {
 }
 
 /**
   * @brief This function handles System tick timer.
+  * @note  弱定义：链接调度器时由移植层 (port.c) 的实现接管，
+  *        移植层同样调用 board_tick_hook() 推进 HAL 时基
   */
-void SysTick_Handler(void)
+__weak void SysTick_Handler(void)
 {
-  HAL_IncTick();
+  board_tick_hook(1);
 }
\ No newline at end of file
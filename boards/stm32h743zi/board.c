@@ -18,7 +18,8 @@ void board_init(void)
     HAL_Init();
     SystemClock_Config();
 
-    HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_2);
+    /* 4 位全部用于抢占优先级，与调度器 BASEPRI 阈值一致 */
+    HAL_NVIC_SetPriorityGrouping(NVIC_PRIORITYGROUP_4);
 }
 
 /* 简单封装，应用层不直接调用 HAL */
@@ -32,6 +33,14 @@ uint32_t board_millis(void)
     return HAL_GetTick();
 }
 
+/* HAL 时基：SysTick 由调度器接管时经移植层调用，保证 HAL_Delay/超时正常推进 */
+void board_tick_hook(uint32_t ticks)
+{
+    while (ticks--) {
+        HAL_IncTick();
+    }
+}
+
 #if BOARD_HAS_LED
 /* LED 硬件映射表 */
 typedef struct {
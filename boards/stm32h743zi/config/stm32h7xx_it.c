@@ -36,7 +36,7 @@
 #include "stm32h7xx_it.h"
 
 /* USER CODE BEGIN 0 */
-
+#include "board.h"
 /* USER CODE END 0 */
 
 /* External variables --------------------------------------------------------*/
@@ -76,8 +76,9 @@ void HardFault_Handler(void)
 
 /**
 * @brief This function handles Memory management fault.
+* @note  弱定义：开启 SCHED_MPU_STACK_GUARD 时由移植层 (port.c) 的实现接管
 */
-void MemManage_Handler(void)
+__weak void MemManage_Handler(void)
 {
   /* USER CODE BEGIN MemoryManagement_IRQn 0 */
 
@@ -150,8 +151,9 @@ void DebugMon_Handler(void)
 
 /**
 * @brief This function handles Pendable request for system service.
+* @note  弱定义：链接调度器时由移植层 (port.c) 的实现接管
 */
-void PendSV_Handler(void)
+__weak void PendSV_Handler(void)
 {
   /* USER CODE BEGIN PendSV_IRQn 0 */
 
@@ -163,12 +165,15 @@ void PendSV_Handler(void)
 
 /**
 * @brief This function handles System tick timer.
+* @note  弱定义：链接调度器时由移植层 (port.c) 的实现接管，
+*        移植层同样调用 board_tick_hook() 推进 HAL 时基
 */
-void SysTick_Handler(void)
+__weak void SysTick_Handler(void)
 {
   /* USER CODE BEGIN SysTick_IRQn 0 */
 
   /* USER CODE END SysTick_IRQn 0 */
+  board_tick_hook(1);
   HAL_SYSTICK_IRQHandler();
   /* USER CODE BEGIN SysTick_IRQn 1 */
 
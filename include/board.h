@@ -9,6 +9,10 @@ void     board_init(void);
 void     board_delay_ms(uint32_t ms);
 uint32_t board_millis(void);
 
+/* 系统滴答推进 ticks 个 (1 ms/滴答)：维护 board_millis()/HAL 超时的时基。
+ * 调度器接管 SysTick 时由移植层在滴答中断与无滴答空闲补偿处调用 */
+void     board_tick_hook(uint32_t ticks);
+
 /* LED 抽象层：逻辑 ID 设计，避免硬件细节泄露 */
 typedef enum {
     BOARD_LED_1 = 0,
@@ -0,0 +1,148 @@
+/**
+ * @file    hylink_bench_crc.c
+ * @brief   HYlink CRC16 后端校验与吞吐基准
+ *
+ * 测试方法:
+ * 1. 用固定种子生成随机数据,对每个已编译的后端 (table / slice4 / 板子支持时的 hw)
+ *    计算 BENCH_CHECK_CASES 组随机起始地址 (含非对齐)、随机长度 (0-1024) 的 CRC,
+ *    每组随机拆成两段分段计算,结果与单表实现逐一比较
+ * 2. 每个后端对 1024 字节块重复计算至少 BENCH_MIN_MS 毫秒,输出 MB/s
+ *
+ * 期望结果: 所有后端 mismatch 为 0; slice4 明显快于 table,hw 在 H743 上最快。
+ *
+ * 硬件上 RTT 通道 0 输出; BOARD=posix 时 printf 输出后退出。
+ */
+
+#include "hylink_parser.h"
+#include "hylink_crc.h"
+#include "board.h"
+
+#if defined(BOARD_POSIX)
+#include <stdio.h>
+#define bench_printf(...)  printf(__VA_ARGS__)
+#else
+#include "SEGGER_RTT.h"
+#define bench_printf(...)  SEGGER_RTT_printf(0, __VA_ARGS__)
+#endif
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_BUFFER_SIZE     4096
+#define BENCH_CHECK_CASES     2000
+#define BENCH_BLOCK_SIZE      HYLINK_MAX_DATA_SIZE
+#define BENCH_MIN_MS          200
+
+typedef uint16_t (*bench_crc_func_t)(uint16_t crc, const uint8_t *data, uint16_t len);
+
+typedef struct {
+    const char       *name;
+    bench_crc_func_t  func;
+} bench_backend_t;
+
+static const bench_backend_t g_backends[] = {
+    { "table",  hylink_crc16_update_table  },
+    { "slice4", hylink_crc16_update_slice4 },
+#if HYLINK_CRC_BACKEND == HYLINK_CRC_BACKEND_HW
+    { "hw",     hylink_crc16_update_hw     },
+#endif
+};
+
+static uint8_t           g_buffer[BENCH_BUFFER_SIZE];
+static uint32_t          g_seed = 1;
+static volatile uint16_t g_sink;
+
+/* ========================================================================
+ * 辅助函数
+ * ======================================================================== */
+
+static uint32_t bench_rand(void)
+{
+    g_seed = g_seed * 1664525U + 1013904223U;
+    return g_seed >> 8;
+}
+
+/**
+ * 随机数据校验: 与单表实现比较
+ *
+ * @return 不一致的组数
+ */
+static uint32_t bench_check(bench_crc_func_t func)
+{
+    uint32_t mismatches = 0;
+
+    g_seed = 1;
+
+    for (uint32_t i = 0; i < BENCH_CHECK_CASES; i++) {
+        uint16_t len   = (uint16_t)(bench_rand() % (HYLINK_MAX_DATA_SIZE + 1U));
+        uint32_t off   = bench_rand() % (BENCH_BUFFER_SIZE - HYLINK_MAX_DATA_SIZE);
+        uint16_t split = (uint16_t)(bench_rand() % (len + 1U));
+        const uint8_t *data = &g_buffer[off];
+
+        uint16_t expected = hylink_crc16_update_table(HYLINK_CRC16_INIT, data, len);
+        uint16_t crc = func(HYLINK_CRC16_INIT, data, split);
+        crc = func(crc, data + split, (uint16_t)(len - split));
+
+        if (crc != expected) {
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+/**
+ * 吞吐测量
+ *
+ * @return MB/s
+ */
+static uint32_t bench_throughput(bench_crc_func_t func)
+{
+    uint32_t blocks = 0;
+    uint32_t start = board_millis();
+    uint32_t elapsed;
+
+    do {
+        for (uint32_t i = 0; i < 64; i++) {
+            g_sink = func(HYLINK_CRC16_INIT, g_buffer, BENCH_BLOCK_SIZE);
+        }
+        blocks += 64;
+        elapsed = board_millis() - start;
+    } while (elapsed < BENCH_MIN_MS);
+
+    return blocks * BENCH_BLOCK_SIZE / (elapsed * 1000U);
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+
+    for (uint32_t i = 0; i < BENCH_BUFFER_SIZE; i++) {
+        g_buffer[i] = (uint8_t)bench_rand();
+    }
+
+    bench_printf("\n[hylink_bench_crc] %u random cases, %u byte blocks\n",
+                 (unsigned)BENCH_CHECK_CASES, (unsigned)BENCH_BLOCK_SIZE);
+    bench_printf("backend, mismatches, MB/s\n");
+
+    for (uint32_t b = 0; b < sizeof(g_backends) / sizeof(g_backends[0]); b++) {
+        uint32_t mismatches = bench_check(g_backends[b].func);
+        uint32_t mbps = bench_throughput(g_backends[b].func);
+
+        bench_printf("%s, %u, %u\n", g_backends[b].name, (unsigned)mismatches, (unsigned)mbps);
+    }
+
+    bench_printf("[hylink_bench_crc] done\n");
+
+#if defined(BOARD_POSIX)
+    return 0;
+#else
+    while (1) {
+    }
+#endif
+}
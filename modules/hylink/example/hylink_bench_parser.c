@@ -0,0 +1,169 @@
+/**
+ * @file    hylink_bench_parser.c
+ * @brief   HYlink解析器吞吐基准 (主机运行)
+ *
+ * 测试方法:
+ * 1. 用固定种子生成两段约 4 MB 的字节流:
+ *    - clean: 连续的合法数据包 (包体 0-1024 字节随机)
+ *    - noisy: 数据包之间插入随机噪声 (含大量同步字节),约 1/4 的包随机翻转一位
+ * 2. 每段流分别以 1 字节 / 64 字节 / 1024 字节为单位喂给解析器,重复到至少 0.2 秒
+ * 3. 输出每种喂入方式的 MB/s、成功包数与包内容摘要
+ *
+ * 期望结果: 同一段流不同喂入方式的包数、错误统计与摘要完全一致;
+ * 批量喂入 (空闲时按字查找同步字,包头/包体整段拷贝) 明显快于逐字节喂入。
+ *
+ * 运行: cmake -DBOARD=posix -DBUILD_HYLINK_EXAMPLE=ON,
+ *       然后执行 build/bin/posix/examples/hylink_bench_parser
+ */
+
+#include "hylink_parser.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_STREAM_SIZE     (4U * 1024U * 1024U)
+#define BENCH_MIN_SECONDS     0.2
+
+static const uint16_t g_chunk_sizes[] = { 1, 64, 1024 };
+
+static uint8_t  g_stream[BENCH_STREAM_SIZE + HYLINK_HEADER_SIZE + HYLINK_MAX_DATA_SIZE];
+static uint32_t g_digest;
+static uint32_t g_seed;
+
+/* ========================================================================
+ * 辅助函数
+ * ======================================================================== */
+
+static uint32_t bench_rand(void)
+{
+    g_seed = g_seed * 1664525U + 1013904223U;
+    return g_seed >> 8;
+}
+
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void on_packet(const hylink_packet_t *packet)
+{
+    const uint8_t *bytes = (const uint8_t *)&packet->header;
+
+    for (uint16_t i = 0; i < HYLINK_HEADER_SIZE; i++) {
+        g_digest = g_digest * 31U + bytes[i];
+    }
+    for (uint16_t i = 0; i < packet->data_len; i++) {
+        g_digest = g_digest * 31U + packet->data[i];
+    }
+}
+
+/**
+ * 生成字节流
+ *
+ * @param noisy  true=包间插入噪声并随机损坏部分包
+ * @return       流长度
+ */
+static uint32_t build_stream(bool noisy)
+{
+    uint32_t len = 0;
+
+    g_seed = noisy ? 2U : 1U;
+
+    while (len < BENCH_STREAM_SIZE) {
+        if (noisy) {
+            uint32_t gap = bench_rand() % 64U;
+            for (uint32_t i = 0; i < gap; i++) {
+                uint32_t r = bench_rand();
+                g_stream[len++] = (r % 4U == 0) ? HYLINK_SYNC_WORD_L : (uint8_t)(r >> 4);
+            }
+        }
+
+        uint16_t data_len = (uint16_t)(bench_rand() % (HYLINK_MAX_DATA_SIZE + 1U));
+        hylink_header_t *header = (hylink_header_t *)&g_stream[len];
+        uint8_t *data = &g_stream[len + HYLINK_HEADER_SIZE];
+
+        for (uint16_t i = 0; i < data_len; i++) {
+            data[i] = (uint8_t)bench_rand();
+        }
+
+        header->sync_word_l = HYLINK_SYNC_WORD_L;
+        header->sync_word_h = HYLINK_SYNC_WORD_H;
+        HYLINK_SET_LENGTH(header, HYLINK_HEADER_SIZE + data_len);
+        header->device_id  = DEVICE_INS;
+        header->seq_number = (uint8_t)len;
+        header->cmd        = CMD_ATTITUDE_DATA;
+        header->reserved   = 0;
+        HYLINK_SET_DATA_CRC(header, hylink_calc_crc16(data, data_len));
+        header->check_header = hylink_calc_header_checksum(header);
+
+        if (noisy && bench_rand() % 4U == 0) {
+            g_stream[len + bench_rand() % (HYLINK_HEADER_SIZE + data_len)] ^=
+                (uint8_t)(1U << (bench_rand() % 8U));
+        }
+
+        len += HYLINK_HEADER_SIZE + data_len;
+    }
+
+    return len;
+}
+
+/* ========================================================================
+ * 测量
+ * ======================================================================== */
+
+static void bench_stream(const char *name, uint32_t len)
+{
+    for (uint32_t c = 0; c < sizeof(g_chunk_sizes) / sizeof(g_chunk_sizes[0]); c++) {
+        uint16_t chunk = g_chunk_sizes[c];
+        hylink_parser_stats_t stats;
+        uint32_t digest = 0;
+        uint32_t passes = 0;
+        double start = bench_now();
+        double elapsed;
+
+        do {
+            hylink_parser_init(on_packet);
+            g_digest = 0;
+
+            for (uint32_t off = 0; off < len; off += chunk) {
+                uint32_t n = (len - off < chunk) ? (len - off) : chunk;
+                hylink_parser_feed(&g_stream[off], (uint16_t)n);
+            }
+
+            digest = g_digest;
+            passes++;
+            elapsed = bench_now() - start;
+        } while (elapsed < BENCH_MIN_SECONDS);
+
+        hylink_parser_get_stats(&stats);
+
+        printf("%s, %u, %.1f, %u, %u, %u, 0x%08x\n", name, (unsigned)chunk,
+               (double)len * passes / elapsed / 1e6,
+               (unsigned)stats.total_packets, (unsigned)stats.crc_errors,
+               (unsigned)stats.header_errors, (unsigned)digest);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    printf("\n[hylink_bench_parser] %u byte streams\n", (unsigned)BENCH_STREAM_SIZE);
+    printf("stream, chunk, MB/s, packets, crc_errors, header_errors, digest\n");
+
+    bench_stream("clean", build_stream(false));
+    bench_stream("noisy", build_stream(true));
+
+    printf("[hylink_bench_parser] done\n");
+
+    return 0;
+}
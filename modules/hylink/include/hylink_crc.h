@@ -0,0 +1,85 @@
+/**
+ * @file    hylink_crc.h
+ * @brief   HYlink CRC16-CCITT 计算后端 (多项式0x1021, 初值0xFFFF)
+ * @author  EmbeddedTemplate
+ *
+ * 后端在构建时按板子选择 (CMake HYLINK_CRC_BACKEND):
+ * - table:  单表逐字节查表 (256 项),参考实现
+ * - slice4: 四表 slicing-by-4,每次处理 4 字节 (表占 2 KB Flash),可移植
+ * - hw:     STM32H7 硬件 CRC 外设,可选 DMA 喂数据 (仅 stm32h743zi)
+ *
+ * 所有后端结果与单表实现一致,可用 example/hylink_bench_crc.c 在目标上核对。
+ */
+
+#ifndef HYLINK_CRC_H
+#define HYLINK_CRC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 配置参数
+ * ======================================================================== */
+
+#define HYLINK_CRC_BACKEND_TABLE    0
+#define HYLINK_CRC_BACKEND_SLICE4   1
+#define HYLINK_CRC_BACKEND_HW       2
+
+#ifndef HYLINK_CRC_BACKEND
+#define HYLINK_CRC_BACKEND          HYLINK_CRC_BACKEND_SLICE4
+#endif
+
+/* 硬件后端：包体不短于该长度时由 DMA 喂入 CRC 外设 (0 表示不使用 DMA) */
+#ifndef HYLINK_CRC_HW_DMA_MIN_LEN
+#define HYLINK_CRC_HW_DMA_MIN_LEN   0
+#endif
+
+#define HYLINK_CRC16_INIT           0xFFFFU
+
+/* ========================================================================
+ * CRC API
+ * ======================================================================== */
+
+/**
+ * 用构建时选择的后端继续计算 CRC16
+ *
+ * 分段计算与一次计算结果相同:
+ *   crc = hylink_crc16_update(HYLINK_CRC16_INIT, a, len_a);
+ *   crc = hylink_crc16_update(crc, b, len_b);
+ *
+ * @param crc   之前的 CRC 值 (首段传 HYLINK_CRC16_INIT)
+ * @param data  数据指针
+ * @param len   数据长度
+ * @return      更新后的 CRC16
+ */
+uint16_t hylink_crc16_update(uint16_t crc, const uint8_t *data, uint16_t len);
+
+/**
+ * 单表逐字节实现 (参考实现,始终可用)
+ */
+uint16_t hylink_crc16_update_table(uint16_t crc, const uint8_t *data, uint16_t len);
+
+/**
+ * slicing-by-4 实现 (始终可用)
+ */
+uint16_t hylink_crc16_update_slice4(uint16_t crc, const uint8_t *data, uint16_t len);
+
+#if HYLINK_CRC_BACKEND == HYLINK_CRC_BACKEND_HW
+/**
+ * STM32H7 硬件 CRC 实现
+ *
+ * CRC 外设为全局共享资源,由 busy 标志独占,计算期间不关中断;
+ * 外设被抢占的上下文占用时改用 slicing-by-4 计算。可在任务与中断中调用
+ */
+uint16_t hylink_crc16_update_hw(uint16_t crc, const uint8_t *data, uint16_t len);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HYLINK_CRC_H */
@@ -4,15 +4,17 @@
  * @author  EmbeddedTemplate
  *
  * 设计原则:
- * - 状态机驱动: 逐字节解析,不依赖完整包
- * - 零拷贝: 解析完成后通过回调通知,避免额外拷贝
+ * - 状态机驱动: 按段解析,不依赖完整包 (空闲时按字查找同步字,包头/包体整段拷贝)
+ * - 零拷贝: 包体直接写入缓冲池槽位 (hylink_pool.h),回调交出槽位指针
  * - 健壮性: 错误自动恢复,不会因单个错包导致后续包丢失
+ * - 多实例: 每条链路一个 hylink_parser_t,原单链路API为默认实例的封装
  */
 
 #ifndef HYLINK_PARSER_H
 #define HYLINK_PARSER_H
 
 #include "hylink_protocol.h"
+#include "hylink_pool.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,16 +25,104 @@ extern "C" {
  * ======================================================================== */
 
 /**
- * 数据包接收回调
+ * 数据包接收回调 (默认实例)
  *
  * @param packet  解析完成的数据包
  *
- * @note packet指针仅在回调期间有效,需要立即处理或拷贝
+ * @note packet指针仅在回调期间有效; 需要保留时在回调中调用 hylink_pool_ref(),
+ *       用完后 hylink_pool_release() (无需拷贝)
  */
 typedef void (*hylink_packet_callback_t)(const hylink_packet_t *packet);
 
+/**
+ * 数据包接收回调 (多实例)
+ *
+ * @param packet  解析完成的数据包
+ * @param user    hylink_parser_ctx_init 传入的用户指针
+ *
+ * @note packet指针仅在回调期间有效; 需要保留时在回调中调用 hylink_pool_ref(),
+ *       用完后 hylink_pool_release() (无需拷贝)
+ */
+typedef void (*hylink_parser_callback_t)(const hylink_packet_t *packet, void *user);
+
+/**
+ * 解析统计信息
+ */
+typedef struct {
+    uint32_t total_packets;     /* 成功解析的包总数 */
+    uint32_t crc_errors;        /* CRC错误计数 */
+    uint32_t header_errors;     /* 包头错误计数 */
+    uint32_t length_errors;     /* 长度错误计数 */
+    uint32_t pool_exhausted;    /* 缓冲池无空闲槽位而丢弃的包 */
+} hylink_parser_stats_t;
+
+/**
+ * 解析器实例 (由调用者静态分配,每条链路一个)
+ *
+ * 成员由解析器内部维护,调用者不应直接访问
+ */
+typedef struct {
+    uint8_t                  state;         /* 状态机状态 */
+    uint16_t                 rx_count;      /* 当前接收字节计数 */
+    uint16_t                 expected_len;  /* 期望的数据长度 */
+    uint16_t                 data_crc;      /* 已接收包体的CRC (边收边算) */
+    hylink_parser_callback_t callback;
+    void                    *user;
+    hylink_parser_stats_t    stats;
+    hylink_header_t          header;        /* 包头接收缓冲 (验证通过后拷入槽位) */
+    hylink_packet_t         *packet;        /* 正在接收的包 (缓冲池槽位) */
+} hylink_parser_t;
+
+/* ========================================================================
+ * 多实例解析器API
+ *
+ * 每个实例的状态互不共享,不同链路在各自的中断/任务中并发解析无需加锁;
+ * 同一实例不可在多个上下文中同时调用
+ * ======================================================================== */
+
+/**
+ * 初始化解析器实例 (清零实例,包括统计)
+ *
+ * 不读取实例原有内容,栈上/未初始化的实例可直接使用。对正在使用的实例
+ * 重新初始化前先调用 hylink_parser_ctx_deinit(),否则正在接收的包占用的
+ * 缓冲池槽位不会归还
+ *
+ * @param parser    解析器实例
+ * @param callback  数据包回调函数
+ * @param user      回调的用户指针 (例如链路描述)
+ */
+void hylink_parser_ctx_init(hylink_parser_t *parser, hylink_parser_callback_t callback, void *user);
+
+/**
+ * 喂数据给解析器实例
+ *
+ * @param parser  解析器实例
+ * @param data    数据指针
+ * @param len     数据长度
+ *
+ * @note 可以逐字节喂入,也可以批量喂入 (批量喂入更快,结果与逐字节喂入完全一致)
+ */
+void hylink_parser_ctx_feed(hylink_parser_t *parser, const uint8_t *data, uint16_t len);
+
+/**
+ * 重置解析器实例 (丢弃正在接收的包,保留统计)
+ */
+void hylink_parser_ctx_reset(hylink_parser_t *parser);
+
+/**
+ * 停用解析器实例: 归还正在接收的包占用的缓冲池槽位
+ *
+ * 之后实例可以丢弃,或重新 hylink_parser_ctx_init()
+ */
+void hylink_parser_ctx_deinit(hylink_parser_t *parser);
+
+/**
+ * 获取解析器实例的统计信息
+ */
+void hylink_parser_ctx_get_stats(const hylink_parser_t *parser, hylink_parser_stats_t *stats);
+
 /* ========================================================================
- * 解析器API
+ * 解析器API (单链路,默认实例)
  * ======================================================================== */
 
 /**
@@ -48,7 +138,7 @@ void hylink_parser_init(hylink_packet_callback_t callback);
  * @param data  数据指针
  * @param len   数据长度
  *
- * @note 可以逐字节喂入,也可以批量喂入
+ * @note 可以逐字节喂入,也可以批量喂入 (批量喂入更快,结果与逐字节喂入完全一致)
  * @note 线程安全: 不可在中断和主循环同时调用
  */
 void hylink_parser_feed(const uint8_t *data, uint16_t len);
@@ -61,13 +151,6 @@ void hylink_parser_reset(void);
 /**
  * 获取解析统计信息
  */
-typedef struct {
-    uint32_t total_packets;     /* 成功解析的包总数 */
-    uint32_t crc_errors;        /* CRC错误计数 */
-    uint32_t header_errors;     /* 包头错误计数 */
-    uint32_t length_errors;     /* 长度错误计数 */
-} hylink_parser_stats_t;
-
 void hylink_parser_get_stats(hylink_parser_stats_t *stats);
 
 /* ========================================================================
@@ -83,7 +166,7 @@ void hylink_parser_get_stats(hylink_parser_stats_t *stats);
 uint8_t hylink_calc_header_checksum(const hylink_header_t *header);
 
 /**
- * 计算数据CRC16 (CRC16-CCITT)
+ * 计算数据CRC16 (CRC16-CCITT,后端见 hylink_crc.h)
  *
  * @param data  数据指针
  * @param len   数据长度
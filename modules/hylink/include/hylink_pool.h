@@ -0,0 +1,86 @@
+/**
+ * @file    hylink_pool.h
+ * @brief   HYlink数据包缓冲池 - 固定块 + 引用计数
+ * @author  EmbeddedTemplate
+ *
+ * 设计原则:
+ * - 静态分配: HYLINK_POOL_SIZE 个 hylink_packet_t 槽位,不使用堆
+ * - 零拷贝: 解析器直接把包头/包体写入槽位,回调把槽位指针交给消费者
+ * - 引用计数: 多个消费者可共享同一个包,最后一个释放者归还槽位
+ * - 无锁: 分配/引用/释放使用原子操作,中断与任务中均可调用
+ *
+ * 所有权约定:
+ * - 解析器在回调期间持有一个引用,回调返回后释放
+ * - 消费者需要在回调之后继续使用时,在回调中调用 hylink_pool_ref(),
+ *   用完后调用 hylink_pool_release()
+ */
+
+#ifndef HYLINK_POOL_H
+#define HYLINK_POOL_H
+
+#include "hylink_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 配置参数
+ * ======================================================================== */
+
+#ifndef HYLINK_POOL_SIZE
+#define HYLINK_POOL_SIZE    4       /* 槽位数 (每个约 1 KB) */
+#endif
+
+/* ========================================================================
+ * 类型定义
+ * ======================================================================== */
+
+/**
+ * 缓冲池统计信息
+ */
+typedef struct {
+    uint32_t allocs;            /* 成功分配次数 */
+    uint32_t exhausted;         /* 无空闲槽位导致分配失败的次数 */
+    uint32_t bad_refs;          /* 被拒绝的引用次数 (槽位空闲、计数已满或指针不属于缓冲池) */
+    uint32_t bad_releases;      /* 被忽略的释放次数 (计数已为 0 或指针不属于缓冲池) */
+    uint16_t free;              /* 当前空闲槽位数 */
+    uint16_t min_free;          /* 历史最少空闲槽位数 */
+} hylink_pool_stats_t;
+
+/* ========================================================================
+ * 缓冲池API
+ * ======================================================================== */
+
+/**
+ * 分配一个槽位 (引用计数为 1)
+ *
+ * @return 槽位指针, 无空闲槽位时返回 NULL 并计入 exhausted
+ */
+hylink_packet_t *hylink_pool_alloc(void);
+
+/**
+ * 增加引用 (packet 必须来自缓冲池且当前持有引用)
+ *
+ * @return false=槽位空闲、计数已达 255 或指针不属于缓冲池, 未增加引用并计入
+ *         bad_refs; 调用者不得使用或释放该包
+ */
+bool hylink_pool_ref(const hylink_packet_t *packet);
+
+/**
+ * 释放引用, 计数归零时归还槽位
+ *
+ * 计数已为 0 或指针不属于缓冲池时忽略并计入 bad_releases (所有权错误)
+ */
+void hylink_pool_release(const hylink_packet_t *packet);
+
+/**
+ * 获取缓冲池统计信息
+ */
+void hylink_pool_get_stats(hylink_pool_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HYLINK_POOL_H */
@@ -0,0 +1,156 @@
+/**
+ * @file    hylink_crc_stm32h7.c
+ * @brief   HYlink CRC16 硬件后端 (STM32H7 CRC 外设,可选 DMA 喂数据)
+ *
+ * 外设配置: 16 位多项式 0x1021,输入/输出不反转,每次计算前把上一段的
+ * CRC 写入 INIT 再复位,因此支持分段计算。
+ *
+ * CRC 外设按高位在前处理写入 DR 的字,而内存中的字节为小端序,
+ * 整字写入前用 REV 交换字节序; DMA 按字节写入 DR,无需交换。
+ *
+ * 外设由 busy 标志 (原子置位) 独占,不关中断: 抢占了正在使用外设的
+ * 任务/低优先级中断的调用者改用 slicing-by-4 软件实现,结果相同。
+ */
+
+#include "hylink_crc.h"
+#include "stm32h7xx_hal.h"
+#include <string.h>
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define CRC_HW_POLY             0x1021U
+
+#if HYLINK_CRC_HW_DMA_MIN_LEN > 0
+#define CRC_HW_DMA_STREAM       DMA2_Stream7    /* 内存到外设: 数据 -> CRC->DR */
+#define CRC_HW_DTCM_BASE        0x20000000UL    /* DMA1/2 不能访问 DTCM,此区域的数据由 CPU 写入 */
+#define CRC_HW_DTCM_END         0x20020000UL
+#endif
+
+/* ========================================================================
+ * 私有变量
+ * ======================================================================== */
+
+static bool crc_hw_ready = false;
+static bool crc_hw_busy  = false;   /* 外设占用标志 (__atomic_test_and_set) */
+
+#if HYLINK_CRC_HW_DMA_MIN_LEN > 0
+static DMA_HandleTypeDef hdma_crc;
+#endif
+
+/* ========================================================================
+ * 内部函数
+ * ======================================================================== */
+
+/**
+ * 首次使用时使能时钟并配置外设 (调用者持有 busy 标志)
+ */
+static void crc_hw_init(void)
+{
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    CRC->POL = CRC_HW_POLY;
+    CRC->CR  = CRC_CR_POLYSIZE_0;   /* 16 位多项式, REV_IN = REV_OUT = 0 */
+
+#if HYLINK_CRC_HW_DMA_MIN_LEN > 0
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+    /* 存储器到存储器模式: "外设" 端为源数据 (递增), "存储器" 端为 CRC->DR (固定) */
+    hdma_crc.Instance                 = CRC_HW_DMA_STREAM;
+    hdma_crc.Init.Request             = DMA_REQUEST_MEM2MEM;
+    hdma_crc.Init.Direction           = DMA_MEMORY_TO_MEMORY;
+    hdma_crc.Init.PeriphInc           = DMA_PINC_ENABLE;
+    hdma_crc.Init.MemInc              = DMA_MINC_DISABLE;
+    hdma_crc.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_crc.Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    hdma_crc.Init.Mode                = DMA_NORMAL;
+    hdma_crc.Init.Priority            = DMA_PRIORITY_LOW;
+    hdma_crc.Init.FIFOMode            = DMA_FIFOMODE_ENABLE;   /* 存储器到存储器模式必须启用 FIFO */
+    hdma_crc.Init.FIFOThreshold       = DMA_FIFO_THRESHOLD_FULL;
+    hdma_crc.Init.MemBurst            = DMA_MBURST_SINGLE;
+    hdma_crc.Init.PeriphBurst         = DMA_PBURST_SINGLE;
+    HAL_DMA_Init(&hdma_crc);
+#endif
+
+    crc_hw_ready = true;
+}
+
+#if HYLINK_CRC_HW_DMA_MIN_LEN > 0
+/**
+ * 由 DMA 把数据逐字节写入 CRC->DR 并等待完成
+ *
+ * 等待期间中断保持开启 (只持有 busy 标志),传输时间不计入中断屏蔽时间
+ *
+ * @return false=数据位于 DTCM 或 DMA 出错 (外设已复位到本段初值),调用者改用 CPU 写入
+ */
+static bool crc_hw_feed_dma(const uint8_t *data, uint16_t len)
+{
+    uint32_t addr = (uint32_t)data;
+
+    if (addr >= CRC_HW_DTCM_BASE && addr < CRC_HW_DTCM_END) {
+        return false;
+    }
+
+    /* DMA 绕过 D-Cache 读取,先把数据写回 SRAM */
+    uint32_t start = addr & ~31UL;
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(addr + len - start));
+
+    if (HAL_DMA_Start(&hdma_crc, addr, (uint32_t)&CRC->DR, len) != HAL_OK) {
+        return false;
+    }
+
+    if (HAL_DMA_PollForTransfer(&hdma_crc, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY) != HAL_OK) {
+        /* 已写入部分数据,丢弃后由 CPU 重新计算 */
+        CRC->CR |= CRC_CR_RESET;
+        return false;
+    }
+
+    return true;
+}
+#endif
+
+/* ========================================================================
+ * 公共 API 实现
+ * ======================================================================== */
+
+uint16_t hylink_crc16_update_hw(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+    if (__atomic_test_and_set(&crc_hw_busy, __ATOMIC_ACQUIRE)) {
+        /* 被抢占的上下文正在使用外设,不能打断它的计算 */
+        return hylink_crc16_update_slice4(crc, data, len);
+    }
+
+    if (!crc_hw_ready) {
+        crc_hw_init();
+    }
+
+    /* 从上一段的结果继续 */
+    CRC->INIT = crc;
+    CRC->CR |= CRC_CR_RESET;
+
+#if HYLINK_CRC_HW_DMA_MIN_LEN > 0
+    if (len >= HYLINK_CRC_HW_DMA_MIN_LEN && crc_hw_feed_dma(data, len)) {
+        len = 0;
+    }
+#endif
+
+    while (len >= 4) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));   /* M7 支持非对齐字加载 */
+        CRC->DR = __REV(word);
+        data += 4;
+        len -= 4;
+    }
+
+    while (len > 0) {
+        *(volatile uint8_t *)&CRC->DR = *data++;
+        len--;
+    }
+
+    crc = (uint16_t)CRC->DR;
+
+    __atomic_clear(&crc_hw_busy, __ATOMIC_RELEASE);
+
+    return crc;
+}
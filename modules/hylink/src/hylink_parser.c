@@ -4,59 +4,15 @@
  */
 
 #include "hylink_parser.h"
+#include "hylink_crc.h"
+#include "hylink_pool.h"
+#include <stddef.h>
 #include <string.h>
 
 /* ========================================================================
- * CRC16-CCITT查表法 (多项式0x1021)
+ * 包头校验和 (CRC16 见 hylink_crc.c)
  * ======================================================================== */
 
-static const uint16_t CRC16_TABLE[256] = {
-    0x0000,0x1021,0x2042,0x3063,0x4084,0x50A5,0x60C6,0x70E7,
-    0x8108,0x9129,0xA14A,0xB16B,0xC18C,0xD1AD,0xE1CE,0xF1EF,
-    0x1231,0x0210,0x3273,0x2252,0x52B5,0x4294,0x72F7,0x62D6,
-    0x9339,0x8318,0xB37B,0xA35A,0xD3BD,0xC39C,0xF3FF,0xE3DE,
-    0x2462,0x3443,0x0420,0x1401,0x64E6,0x74C7,0x44A4,0x5485,
-    0xA56A,0xB54B,0x8528,0x9509,0xE5EE,0xF5CF,0xC5AC,0xD58D,
-    0x3653,0x2672,0x1611,0x0630,0x76D7,0x66F6,0x5695,0x46B4,
-    0xB75B,0xA77A,0x9719,0x8738,0xF7DF,0xE7FE,0xD79D,0xC7BC,
-    0x48C4,0x58E5,0x6886,0x78A7,0x0840,0x1861,0x2802,0x3823,
-    0xC9CC,0xD9ED,0xE98E,0xF9AF,0x8948,0x9969,0xA90A,0xB92B,
-    0x5AF5,0x4AD4,0x7AB7,0x6A96,0x1A71,0x0A50,0x3A33,0x2A12,
-    0xDBFD,0xCBDC,0xFBBF,0xEB9E,0x9B79,0x8B58,0xBB3B,0xAB1A,
-    0x6CA6,0x7C87,0x4CE4,0x5CC5,0x2C22,0x3C03,0x0C60,0x1C41,
-    0xEDAE,0xFD8F,0xCDEC,0xDDCD,0xAD2A,0xBD0B,0x8D68,0x9D49,
-    0x7E97,0x6EB6,0x5ED5,0x4EF4,0x3E13,0x2E32,0x1E51,0x0E70,
-    0xFF9F,0xEFBE,0xDFDD,0xCFFC,0xBF1B,0xAF3A,0x9F59,0x8F78,
-    0x9188,0x81A9,0xB1CA,0xA1EB,0xD10C,0xC12D,0xF14E,0xE16F,
-    0x1080,0x00A1,0x30C2,0x20E3,0x5004,0x4025,0x7046,0x6067,
-    0x83B9,0x9398,0xA3FB,0xB3DA,0xC33D,0xD31C,0xE37F,0xF35E,
-    0x02B1,0x1290,0x22F3,0x32D2,0x4235,0x5214,0x6277,0x7256,
-    0xB5EA,0xA5CB,0x95A8,0x8589,0xF56E,0xE54F,0xD52C,0xC50D,
-    0x34E2,0x24C3,0x14A0,0x0481,0x7466,0x6447,0x5424,0x4405,
-    0xA7DB,0xB7FA,0x8799,0x97B8,0xE75F,0xF77E,0xC71D,0xD73C,
-    0x26D3,0x36F2,0x0691,0x16B0,0x6657,0x7676,0x4615,0x5634,
-    0xD94C,0xC96D,0xF90E,0xE92F,0x99C8,0x89E9,0xB98A,0xA9AB,
-    0x5844,0x4865,0x7806,0x6827,0x18C0,0x08E1,0x3882,0x28A3,
-    0xCB7D,0xDB5C,0xEB3F,0xFB1E,0x8BF9,0x9BD8,0xABBB,0xBB9A,
-    0x4A75,0x5A54,0x6A37,0x7A16,0x0AF1,0x1AD0,0x2AB3,0x3A92,
-    0xFD2E,0xED0F,0xDD6C,0xCD4D,0xBDAA,0xAD8B,0x9DE8,0x8DC9,
-    0x7C26,0x6C07,0x5C64,0x4C45,0x3CA2,0x2C83,0x1CE0,0x0CC1,
-    0xEF1F,0xFF3E,0xCF5D,0xDF7C,0xAF9B,0xBFBA,0x8FD9,0x9FF8,
-    0x6E17,0x7E36,0x4E55,0x5E74,0x2E93,0x3EB2,0x0ED1,0x1EF0
-};
-
-uint16_t hylink_calc_crc16(const uint8_t *data, uint16_t len)
-{
-    uint16_t crc = 0xFFFF;
-
-    for (uint16_t i = 0; i < len; i++) {
-        uint8_t idx = (uint8_t)((crc >> 8) ^ data[i]);
-        crc = (uint16_t)((crc << 8) ^ CRC16_TABLE[idx]);
-    }
-
-    return crc;
-}
-
 uint8_t hylink_calc_header_checksum(const hylink_header_t *header)
 {
     const uint8_t *bytes = (const uint8_t *)header;
@@ -78,19 +34,13 @@ typedef enum {
     STATE_IDLE,           /* 空闲,等待同步字 */
     STATE_SYNC_L,         /* 收到SYNC_L,等待SYNC_H */
     STATE_HEADER,         /* 接收包头 */
-    STATE_DATA,           /* 接收数据 */
+    STATE_DATA,           /* 接收数据 (写入缓冲池槽位) */
+    STATE_SKIP,           /* 缓冲池无空闲槽位,跳过包体 */
 } parser_state_t;
 
-typedef struct {
-    parser_state_t         state;
-    hylink_packet_t        packet;
-    uint16_t               rx_count;      /* 当前接收字节计数 */
-    uint16_t               expected_len;  /* 期望的数据长度 */
-    hylink_packet_callback_t callback;
-    hylink_parser_stats_t  stats;
-} parser_context_t;
-
-static parser_context_t g_parser;
+/* 默认实例 (单链路API) */
+static hylink_parser_t          g_parser;
+static hylink_packet_callback_t g_default_callback;
 
 /* ========================================================================
  * 内部函数
@@ -124,53 +74,97 @@ static bool validate_header(const hylink_header_t *header)
 }
 
 /**
- * 验证数据包
+ * 处理完整数据包
+ *
+ * 回调期间解析器持有槽位的一个引用,回调返回后释放;
+ * 消费者需要保留时在回调中 hylink_pool_ref()
  */
-static bool validate_packet(const hylink_packet_t *packet)
+static void handle_complete_packet(hylink_parser_t *ctx)
 {
-    /* 检查数据CRC */
-    uint16_t calc_crc = hylink_calc_crc16(packet->data, packet->data_len);
-    uint16_t recv_crc = HYLINK_GET_DATA_CRC(&packet->header);
+    hylink_packet_t *packet = ctx->packet;
 
-    return (calc_crc == recv_crc);
-}
+    ctx->packet = NULL;
+    packet->data_len = ctx->expected_len;
 
-/**
- * 处理完整数据包
- */
-static void handle_complete_packet(parser_context_t *ctx)
-{
-    /* 验证数据CRC */
-    if (!validate_packet(&ctx->packet)) {
+    /* 验证数据CRC (接收过程中已累计,完成时只需一次比较) */
+    if (ctx->data_crc != HYLINK_GET_DATA_CRC(&packet->header)) {
         ctx->stats.crc_errors++;
-        return;
+    } else {
+        /* 统计 */
+        ctx->stats.total_packets++;
+
+        /* 回调通知 */
+        if (ctx->callback) {
+            ctx->callback(packet, ctx->user);
+        }
     }
 
-    /* 统计 */
-    ctx->stats.total_packets++;
-
-    /* 回调通知 */
-    if (ctx->callback) {
-        ctx->callback(&ctx->packet);
-    }
+    hylink_pool_release(packet);
 }
 
 /**
- * 状态机复位
+ * 状态机复位 (归还未完成包占用的槽位)
  */
-static void parser_reset_internal(parser_context_t *ctx)
+static void parser_reset_internal(hylink_parser_t *ctx)
 {
+    if (ctx->packet) {
+        hylink_pool_release(ctx->packet);
+        ctx->packet = NULL;
+    }
+
     ctx->state       = STATE_IDLE;
     ctx->rx_count    = 0;
     ctx->expected_len = 0;
 }
 
 /**
- * 处理单字节
+ * 包头接收完成：验证并进入数据接收 (无包体时直接完成)
+ */
+static void handle_header_complete(hylink_parser_t *ctx)
+{
+    if (!validate_header(&ctx->header)) {
+        ctx->stats.header_errors++;
+        parser_reset_internal(ctx);
+        return;
+    }
+
+    /* 计算数据长度 */
+    uint16_t total_len = HYLINK_GET_LENGTH(&ctx->header);
+    ctx->expected_len = total_len - HYLINK_HEADER_SIZE;
+    ctx->data_crc = HYLINK_CRC16_INIT;
+    ctx->rx_count = 0;
+
+    /* 包头有效后才占用槽位,噪声不消耗缓冲池 */
+    ctx->packet = hylink_pool_alloc();
+    if (ctx->packet == NULL) {
+        /* 槽位不足: 按长度跳过包体,保持同步 */
+        ctx->stats.pool_exhausted++;
+        if (ctx->expected_len == 0) {
+            parser_reset_internal(ctx);
+        } else {
+            ctx->state = STATE_SKIP;
+        }
+        return;
+    }
+
+    ctx->packet->header = ctx->header;
+
+    if (ctx->expected_len == 0) {
+        /* 无数据包体,直接处理 */
+        handle_complete_packet(ctx);
+        parser_reset_internal(ctx);
+    } else {
+        /* 继续接收数据 */
+        ctx->state = STATE_DATA;
+    }
+}
+
+/**
+ * 处理单字节 (同步字状态)
  */
-static void process_byte(parser_context_t *ctx, uint8_t byte)
+static void process_byte(hylink_parser_t *ctx, uint8_t byte)
 {
-    uint8_t *raw_header = (uint8_t *)&ctx->packet.header;
+    uint8_t *raw_header = (uint8_t *)&ctx->header;
 
     switch (ctx->state) {
         case STATE_IDLE:
@@ -198,48 +192,124 @@ static void process_byte(parser_context_t *ctx, uint8_t byte)
             }
             break;
 
+        default:
+            parser_reset_internal(ctx);
+            break;
+    }
+}
+
+/* ========================================================================
+ * 批量扫描 (按段处理,结果与逐字节状态机一致)
+ * ======================================================================== */
+
+#define SYNC_L_PATTERN  (0x01010101UL * HYLINK_SYNC_WORD_L)
+
+/**
+ * 查找下一个SYNC_L
+ *
+ * 按字对齐后每次比较 4 字节: v = w ^ pattern 中有零字节即命中
+ * ((v - 0x01010101) & ~v & 0x80808080 非零)
+ *
+ * @return 指向SYNC_L的指针,未找到返回end
+ */
+static const uint8_t *find_sync_l(const uint8_t *p, const uint8_t *end)
+{
+    /* 对齐前的零散字节 */
+    while (p < end && ((uintptr_t)p & (sizeof(uint32_t) - 1U)) != 0) {
+        if (*p == HYLINK_SYNC_WORD_L) {
+            return p;
+        }
+        p++;
+    }
+
+    /* 整字比较,命中的字再逐字节定位 */
+    while (end - p >= (ptrdiff_t)sizeof(uint32_t)) {
+        uint32_t w;
+        memcpy(&w, p, sizeof(w));   /* 已对齐,编译为单条字加载 */
+        uint32_t v = w ^ SYNC_L_PATTERN;
+        if (((v - 0x01010101UL) & ~v & 0x80808080UL) != 0) {
+            break;
+        }
+        p += sizeof(uint32_t);
+    }
+
+    while (p < end && *p != HYLINK_SYNC_WORD_L) {
+        p++;
+    }
+
+    return p;
+}
+
+/**
+ * 按当前状态消费一段数据
+ *
+ * - 空闲: 按字查找SYNC_L
+ * - 包头/数据: 按剩余所需字节数整段拷贝 (包体直接写入缓冲池槽位),同时累计CRC
+ *   (每次调用的耗时只与本段长度有关,包完成时不再集中计算整包CRC)
+ * - 等待SYNC_H: 逐字节处理
+ *
+ * @return 已消费的字节数 (至少 1)
+ */
+static uint16_t process_span(hylink_parser_t *ctx, const uint8_t *p, const uint8_t *end)
+{
+    uint16_t avail = (uint16_t)(end - p);
+    uint16_t n;
+
+    switch (ctx->state) {
+        case STATE_IDLE: {
+            const uint8_t *sync = find_sync_l(p, end);
+            if (sync == end) {
+                return avail;
+            }
+            process_byte(ctx, *sync);
+            return (uint16_t)(sync - p + 1);
+        }
+
         case STATE_HEADER:
-            raw_header[ctx->rx_count++] = byte;
+            n = (uint16_t)(HYLINK_HEADER_SIZE - ctx->rx_count);
+            if (n > avail) {
+                n = avail;
+            }
+            memcpy((uint8_t *)&ctx->header + ctx->rx_count, p, n);
+            ctx->rx_count += n;
 
             if (ctx->rx_count == HYLINK_HEADER_SIZE) {
                 /* 包头接收完成,验证 */
-                if (!validate_header(&ctx->packet.header)) {
-                    ctx->stats.header_errors++;
-                    parser_reset_internal(ctx);
-                    break;
-                }
-
-                /* 计算数据长度 */
-                uint16_t total_len = HYLINK_GET_LENGTH(&ctx->packet.header);
-                ctx->expected_len = total_len - HYLINK_HEADER_SIZE;
-
-                if (ctx->expected_len == 0) {
-                    /* 无数据包体,直接处理 */
-                    ctx->packet.data_len = 0;
-                    handle_complete_packet(ctx);
-                    parser_reset_internal(ctx);
-                } else {
-                    /* 继续接收数据 */
-                    ctx->state = STATE_DATA;
-                    ctx->rx_count = 0;
-                }
+                handle_header_complete(ctx);
             }
-            break;
+            return n;
 
         case STATE_DATA:
-            ctx->packet.data[ctx->rx_count++] = byte;
+            n = (uint16_t)(ctx->expected_len - ctx->rx_count);
+            if (n > avail) {
+                n = avail;
+            }
+            memcpy(&ctx->packet->data[ctx->rx_count], p, n);
+            ctx->data_crc = hylink_crc16_update(ctx->data_crc, p, n);
+            ctx->rx_count += n;
 
             if (ctx->rx_count == ctx->expected_len) {
                 /* 数据接收完成 */
-                ctx->packet.data_len = ctx->expected_len;
                 handle_complete_packet(ctx);
                 parser_reset_internal(ctx);
             }
-            break;
+            return n;
+
+        case STATE_SKIP:
+            n = (uint16_t)(ctx->expected_len - ctx->rx_count);
+            if (n > avail) {
+                n = avail;
+            }
+            ctx->rx_count += n;
+
+            if (ctx->rx_count == ctx->expected_len) {
+                parser_reset_internal(ctx);
+            }
+            return n;
 
         default:
-            parser_reset_internal(ctx);
-            break;
+            process_byte(ctx, *p);
+            return 1;
     }
 }
 
@@ -247,28 +317,75 @@ static void process_byte(parser_context_t *ctx, uint8_t byte)
  * 公共API实现
  * ======================================================================== */
 
+void hylink_parser_ctx_init(hylink_parser_t *parser, hylink_parser_callback_t callback, void *user)
+{
+    /* 实例由调用者提供, 初始化前内容未定义, 不读取直接清零 */
+    memset(parser, 0, sizeof(*parser));
+    parser->callback = callback;
+    parser->user = user;
+    parser->state = STATE_IDLE;
+}
+
+void hylink_parser_ctx_feed(hylink_parser_t *parser, const uint8_t *data, uint16_t len)
+{
+    const uint8_t *end = data + len;
+
+    while (data < end) {
+        data += process_span(parser, data, end);
+    }
+}
+
+void hylink_parser_ctx_reset(hylink_parser_t *parser)
+{
+    parser_reset_internal(parser);
+}
+
+void hylink_parser_ctx_deinit(hylink_parser_t *parser)
+{
+    parser_reset_internal(parser);
+    parser->callback = NULL;
+}
+
+void hylink_parser_ctx_get_stats(const hylink_parser_t *parser, hylink_parser_stats_t *stats)
+{
+    if (stats) {
+        *stats = parser->stats;
+    }
+}
+
+/* ========================================================================
+ * 默认实例封装
+ * ======================================================================== */
+
+static void default_packet_callback(const hylink_packet_t *packet, void *user)
+{
+    (void)user;
+
+    if (g_default_callback) {
+        g_default_callback(packet);
+    }
+}
+
 void hylink_parser_init(hylink_packet_callback_t callback)
 {
-    memset(&g_parser, 0, sizeof(g_parser));
-    g_parser.callback = callback;
-    g_parser.state = STATE_IDLE;
+    g_default_callback = callback;
+
+    /* 默认实例为静态变量 (初始为零), 重复初始化时先归还正在接收的槽位 */
+    hylink_parser_ctx_deinit(&g_parser);
+    hylink_parser_ctx_init(&g_parser, default_packet_callback, NULL);
 }
 
 void hylink_parser_feed(const uint8_t *data, uint16_t len)
 {
-    for (uint16_t i = 0; i < len; i++) {
-        process_byte(&g_parser, data[i]);
-    }
+    hylink_parser_ctx_feed(&g_parser, data, len);
 }
 
 void hylink_parser_reset(void)
 {
-    parser_reset_internal(&g_parser);
+    hylink_parser_ctx_reset(&g_parser);
 }
 
 void hylink_parser_get_stats(hylink_parser_stats_t *stats)
 {
-    if (stats) {
-        *stats = g_parser.stats;
-    }
+    hylink_parser_ctx_get_stats(&g_parser, stats);
 }
@@ -0,0 +1,149 @@
+/**
+ * @file    hylink_pool.c
+ * @brief   HYlink数据包缓冲池实现
+ *
+ * 每个槽位一个引用计数, 0 表示空闲。分配时依次对空闲槽位做 0 -> 1 的
+ * 比较交换, 引用/释放时对计数做加一/减一的比较交换 (拒绝回绕与复活已归还
+ * 的槽位); Cortex-M3/M4/M7 上编译为 LDREX/STREX, 不需要关中断。
+ */
+
+#include "hylink_pool.h"
+#include <stddef.h>
+
+/* ========================================================================
+ * 私有变量
+ * ======================================================================== */
+
+static hylink_packet_t g_pool[HYLINK_POOL_SIZE];
+static uint8_t         g_refcount[HYLINK_POOL_SIZE];
+
+static uint32_t        g_allocs;
+static uint32_t        g_exhausted;
+static uint32_t        g_bad_refs;
+static uint32_t        g_bad_releases;
+static uint16_t        g_min_free = HYLINK_POOL_SIZE;
+
+/* ========================================================================
+ * 内部函数
+ * ======================================================================== */
+
+static uint32_t pool_index(const hylink_packet_t *packet)
+{
+    return (uint32_t)(packet - g_pool);
+}
+
+static bool pool_contains(const hylink_packet_t *packet)
+{
+    return packet >= &g_pool[0] && packet < &g_pool[HYLINK_POOL_SIZE];
+}
+
+static uint16_t pool_count_free(void)
+{
+    uint16_t free = 0;
+
+    for (uint32_t i = 0; i < HYLINK_POOL_SIZE; i++) {
+        if (__atomic_load_n(&g_refcount[i], __ATOMIC_RELAXED) == 0) {
+            free++;
+        }
+    }
+
+    return free;
+}
+
+/**
+ * 更新历史最少空闲槽位数 (统计用, 与分配并发时可能略有滞后)
+ */
+static void pool_update_min_free(void)
+{
+    uint16_t free = pool_count_free();
+    uint16_t min_free = __atomic_load_n(&g_min_free, __ATOMIC_RELAXED);
+
+    while (free < min_free &&
+           !__atomic_compare_exchange_n(&g_min_free, &min_free, free, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+/* ========================================================================
+ * 公共API实现
+ * ======================================================================== */
+
+hylink_packet_t *hylink_pool_alloc(void)
+{
+    for (uint32_t i = 0; i < HYLINK_POOL_SIZE; i++) {
+        uint8_t expected = 0;
+
+        if (__atomic_compare_exchange_n(&g_refcount[i], &expected, 1, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            __atomic_fetch_add(&g_allocs, 1, __ATOMIC_RELAXED);
+            pool_update_min_free();
+            return &g_pool[i];
+        }
+    }
+
+    __atomic_fetch_add(&g_exhausted, 1, __ATOMIC_RELAXED);
+    return NULL;
+}
+
+bool hylink_pool_ref(const hylink_packet_t *packet)
+{
+    if (!packet) {
+        return false;
+    }
+
+    if (!pool_contains(packet)) {
+        __atomic_fetch_add(&g_bad_refs, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    uint8_t *refcount = &g_refcount[pool_index(packet)];
+    uint8_t count = __atomic_load_n(refcount, __ATOMIC_RELAXED);
+
+    do {
+        if (count == 0 || count == UINT8_MAX) {
+            /* 0: 槽位已归还, 不能复活; 255: 再加一会回绕为 0 */
+            __atomic_fetch_add(&g_bad_refs, 1, __ATOMIC_RELAXED);
+            return false;
+        }
+    } while (!__atomic_compare_exchange_n(refcount, &count, (uint8_t)(count + 1), true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    return true;
+}
+
+void hylink_pool_release(const hylink_packet_t *packet)
+{
+    if (!packet) {
+        return;
+    }
+
+    if (!pool_contains(packet)) {
+        __atomic_fetch_add(&g_bad_releases, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    uint8_t *refcount = &g_refcount[pool_index(packet)];
+    uint8_t count = __atomic_load_n(refcount, __ATOMIC_RELAXED);
+
+    /* RELEASE: 之前对包内容的访问在槽位被重新分配前完成 */
+    do {
+        if (count == 0) {
+            /* 多余的释放: 忽略, 不能回绕为 255 使槽位永久占用 */
+            __atomic_fetch_add(&g_bad_releases, 1, __ATOMIC_RELAXED);
+            return;
+        }
+    } while (!__atomic_compare_exchange_n(refcount, &count, (uint8_t)(count - 1), true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+void hylink_pool_get_stats(hylink_pool_stats_t *stats)
+{
+    if (stats) {
+        stats->allocs       = __atomic_load_n(&g_allocs, __ATOMIC_RELAXED);
+        stats->exhausted    = __atomic_load_n(&g_exhausted, __ATOMIC_RELAXED);
+        stats->bad_refs     = __atomic_load_n(&g_bad_refs, __ATOMIC_RELAXED);
+        stats->bad_releases = __atomic_load_n(&g_bad_releases, __ATOMIC_RELAXED);
+        stats->free         = pool_count_free();
+        stats->min_free     = __atomic_load_n(&g_min_free, __ATOMIC_RELAXED);
+    }
+}
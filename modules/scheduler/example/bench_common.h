@@ -0,0 +1,55 @@
+/**
+ * @file    bench_common.h
+ * @brief   硬件基准测试公共部分：DWT CYCCNT 计时与 min/mean/max 统计
+ *
+ * 仅供 example/ 下运行在 Cortex-M 上的基准测试包含 (需要 CMSIS DWT / CoreDebug)。
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <stdint.h>
+#include "board_config.h"  /* CMSIS: DWT / CoreDebug */
+
+/* ========================================================================
+ * 测量统计
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+} bench_stat_t;
+
+static inline void bench_stat_reset(bench_stat_t *st)
+{
+    st->min = UINT32_MAX;
+    st->max = 0;
+    st->sum = 0;
+    st->count = 0;
+}
+
+static inline void bench_stat_add(bench_stat_t *st, uint32_t cycles)
+{
+    if (cycles < st->min) st->min = cycles;
+    if (cycles > st->max) st->max = cycles;
+    st->sum += cycles;
+    st->count++;
+}
+
+/* ========================================================================
+ * DWT 周期计数器
+ * ======================================================================== */
+
+static inline void dwt_cyccnt_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if defined(STM32H743xx)
+    DWT->LAR = 0xC5ACCE55;  /* Cortex-M7 需要解锁 DWT */
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+#endif /* BENCH_COMMON_H */
@@ -0,0 +1,177 @@
+/**
+ * @file    sched_bench_basic.c
+ * @brief   基本任务基准测试：运行到完成的任务共享每个优先级一个栈
+ *
+ * 测试方法：
+ * 1. 优先级 BENCH_SAMPLER_PRIORITY 创建 4 个周期采样基本任务 (周期 2/5/10/20 滴答)
+ * 2. 优先级 BENCH_HANDLER_PRIORITY 创建 4 个事件处理基本任务，生产者任务每个滴答
+ *    轮流激活其中一个 (模拟数据包到达)
+ * 3. 运行 BENCH_ROUND_TICKS 后输出每个基本任务的执行次数与丢失的激活数，
+ *    以及基本任务占用的栈区与 "每个活动一个独立任务" 的对比
+ *
+ * 期望结果：周期任务执行次数与理论值一致，事件任务执行次数等于激活次数，丢失 0；
+ * 8 个活动只占 2 个 TCB 和 2 个共享栈。
+ *
+ * 硬件上 RTT 通道 0 输出；BOARD=posix 时 printf 输出后退出 (虚拟时间下结果逐次相同)。
+ */
+
+#include "scheduler.h"
+#include "sched_basic.h"
+#include "board.h"
+
+#if defined(BOARD_POSIX)
+#include <stdio.h>
+#include <stdlib.h>
+#define bench_printf(...)  printf(__VA_ARGS__)
+#define bench_exit()       exit(0)
+#else
+#include "SEGGER_RTT.h"
+#define bench_printf(...)  SEGGER_RTT_printf(0, __VA_ARGS__)
+#define bench_exit()       do { } while (0)
+#endif
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_HANDLER_PRIORITY    2
+#define BENCH_SAMPLER_PRIORITY    3
+#define BENCH_PRODUCER_PRIORITY   4
+#define BENCH_CTRL_PRIORITY       (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS         1000   /* 测量时长 (滴答) */
+#define BENCH_SAMPLERS            4
+#define BENCH_HANDLERS            4
+
+static const sched_tick_t g_periods[BENCH_SAMPLERS] = { 2, 5, 10, 20 };
+
+static sched_basic_task_t g_samplers[BENCH_SAMPLERS];
+static sched_basic_task_t g_handlers[BENCH_HANDLERS];
+static uint32_t           g_activated[BENCH_HANDLERS];
+static volatile uint32_t  g_sink;
+
+static volatile bool      g_running = true;
+
+/* ========================================================================
+ * 基本任务定义
+ * ======================================================================== */
+
+/**
+ * 周期采样：运行到完成，不阻塞
+ */
+static void basic_sampler(void *param)
+{
+    g_sink += (uint32_t)(uintptr_t)param;
+}
+
+/**
+ * 数据包处理：运行到完成，不阻塞
+ */
+static void basic_handler(void *param)
+{
+    g_sink ^= (uint32_t)(uintptr_t)param;
+}
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+static void task_producer(void *param)
+{
+    (void)param;
+    uint32_t next = 0;
+
+    while (1) {
+        sched_delay(1);
+        if (g_running) {
+            g_activated[next]++;
+            sched_basic_task_activate(&g_handlers[next]);
+            next = (next + 1U) % BENCH_HANDLERS;
+        }
+    }
+}
+
+static void task_idle(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_idle_sleep();
+    }
+}
+
+/* ========================================================================
+ * 测量
+ * ======================================================================== */
+
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+    sched_stack_arena_info_t before;
+    sched_stack_arena_info_t after;
+
+    bench_printf("\n[sched_bench_basic] %u basic tasks, %u ticks\n",
+                 (unsigned)(BENCH_SAMPLERS + BENCH_HANDLERS), (unsigned)BENCH_ROUND_TICKS);
+
+    sched_get_stack_arena_info(&before);
+
+    for (uint32_t i = 0; i < BENCH_SAMPLERS; i++) {
+        sched_basic_task_create(&g_samplers[i], basic_sampler, "Sampler", (void *)(uintptr_t)i,
+                                BENCH_SAMPLER_PRIORITY, 0, g_periods[i]);
+    }
+    for (uint32_t i = 0; i < BENCH_HANDLERS; i++) {
+        sched_basic_task_create(&g_handlers[i], basic_handler, "Handler", (void *)(uintptr_t)i,
+                                BENCH_HANDLER_PRIORITY, 0, 0);
+    }
+
+    sched_get_stack_arena_info(&after);
+
+    sched_delay(BENCH_ROUND_TICKS);
+
+    /* 控制任务优先级最高，读取统计期间基本任务不会运行 */
+    g_running = false;
+
+    bench_printf("task, period, runs, expected, lost\n");
+    for (uint32_t i = 0; i < BENCH_SAMPLERS; i++) {
+        /* 第一次周期激活在创建后一个周期，第 BENCH_ROUND_TICKS 个滴答上控制任务先运行 */
+        bench_printf("sampler%u, %u, %u, %u, %u\n", (unsigned)i, (unsigned)g_periods[i],
+                     (unsigned)g_samplers[i].activations,
+                     (unsigned)((BENCH_ROUND_TICKS - 1U) / g_periods[i]),
+                     (unsigned)g_samplers[i].lost);
+    }
+    for (uint32_t i = 0; i < BENCH_HANDLERS; i++) {
+        bench_printf("handler%u, -, %u, %u, %u\n", (unsigned)i,
+                     (unsigned)g_handlers[i].activations, (unsigned)g_activated[i],
+                     (unsigned)g_handlers[i].lost);
+    }
+
+    uint32_t activities = BENCH_SAMPLERS + BENCH_HANDLERS;
+    bench_printf("stack arena, basic tasks %u B (2 shared stacks), one task each %u B\n",
+                 (unsigned)(after.used_size - before.used_size),
+                 (unsigned)(activities * SCHED_BASIC_STACK_SIZE));
+
+    bench_printf("[sched_bench_basic] done\n");
+    bench_exit();
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_producer, "Producer", 512, NULL, BENCH_PRODUCER_PRIORITY);
+    sched_task_create(task_idle, "Idle", 256, NULL, 0);
+
+    sched_start();
+
+    while (1);
+}
@@ -0,0 +1,171 @@
+/**
+ * @file    sched_bench_fpu.c
+ * @brief   FPU 上下文切换测试：浮点寄存器正确性 + 切换开销
+ *
+ * 测试方法：
+ * 1. 两个同优先级工作任务循环调用 sched_yield()，用 DWT CYCCNT 记录
+ *    "yield -> 下一任务恢复" 的周期数 (与 sched_bench_switch 相同)
+ * 2. 第一轮使用整数工作任务 (不触碰 FPU，基本栈帧)
+ * 3. 第二轮使用浮点工作任务：累加器跨 yield 保存在 S16-S31 中，
+ *    每次恢复后与整数计数推算的精确值比较，不一致即计为错误
+ * 4. 每轮运行 BENCH_ROUND_TICKS 后输出 min/mean/max 与错误数
+ *
+ * 期望结果：浮点任务错误数为 0；整数任务的切换开销与未支持 FPU 时相同，
+ * 浮点任务多出 S16-S31 与惰性压栈 S0-S15 的保存/恢复开销。
+ */
+
+#include "scheduler.h"
+#include "board.h"
+#include "bench_common.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_WORKER_PRIORITY   1
+#define BENCH_CTRL_PRIORITY     (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS       200    /* 每轮测量时长 (ms) */
+#define BENCH_FPU_WORKERS       2
+#define BENCH_FPU_WRAP          (1UL << 20)  /* 计数回绕点，保证累加值可被 float 精确表示 */
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+static volatile uint32_t g_yield_stamp;   /* 最近一次 yield 前的 CYCCNT */
+static volatile bool     g_stamp_valid;   /* 时间戳有效 (排除跨轮次/被 tick 打断的样本) */
+static volatile uint32_t g_fpu_errors;    /* 浮点寄存器被破坏的次数 */
+static bench_stat_t      g_stat;
+
+/**
+ * 记录本次恢复的切换周期，并为下一次 yield 打时间戳
+ */
+static inline void bench_switch_point(void)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (g_stamp_valid) {
+        bench_stat_add(&g_stat, now - g_yield_stamp);
+    }
+
+    g_stamp_valid = true;
+    g_yield_stamp = DWT->CYCCNT;
+    sched_yield();
+}
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+/**
+ * 整数工作任务：从不执行浮点指令
+ */
+static void task_int_worker(void *param)
+{
+    (void)param;
+
+    while (1) {
+        bench_switch_point();
+    }
+}
+
+/**
+ * 浮点工作任务：每个任务使用不同的步长，累加器在 yield 期间保存在浮点寄存器中
+ */
+static void task_fpu_worker(void *param)
+{
+    const float step = (float)(uint32_t)param * 0.25f;
+    float acc = 0.0f;
+    float scaled = 1.0f;
+    uint32_t n = 0;
+
+    while (1) {
+        acc += step;
+        scaled = scaled * 0.5f + 1.0f;  /* 收敛到 2.0，制造更多活跃浮点寄存器 */
+        n++;
+
+        bench_switch_point();
+
+        /* 切换回来后校验：acc 必须等于 n * step (在回绕前可被精确表示) */
+        if (acc != (float)n * step || scaled < 1.0f || scaled > 2.0f) {
+            g_fpu_errors++;
+        }
+
+        if (n == BENCH_FPU_WRAP) {
+            acc = 0.0f;
+            n = 0;
+        }
+    }
+}
+
+/**
+ * 运行一轮测量并输出结果
+ */
+static void bench_round(const char *label, task_function_t worker)
+{
+    task_handle_t workers[BENCH_FPU_WORKERS];
+
+    for (uint32_t i = 0; i < BENCH_FPU_WORKERS; i++) {
+        workers[i] = sched_task_create(worker, "Worker", 512, (void *)(i + 1),
+                                       BENCH_WORKER_PRIORITY);
+    }
+
+    sched_enter_critical();
+    bench_stat_reset(&g_stat);
+    g_stamp_valid = false;
+    g_fpu_errors = 0;
+    sched_exit_critical();
+
+    sched_delay(BENCH_ROUND_TICKS);
+
+    /* 冻结统计：控制任务运行期间工作任务不会执行 */
+    bench_stat_t result = g_stat;
+    uint32_t errors = g_fpu_errors;
+
+    for (uint32_t i = 0; i < BENCH_FPU_WORKERS; i++) {
+        sched_task_delete(workers[i]);
+    }
+
+    uint32_t mean = result.count ? (uint32_t)(result.sum / result.count) : 0;
+    SEGGER_RTT_printf(0, "%s, %u, %u, %u, %u\n", label,
+                      (unsigned)result.min, (unsigned)mean, (unsigned)result.max,
+                      (unsigned)errors);
+}
+
+/**
+ * 控制任务：依次测量整数任务与浮点任务
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_fpu] tasks, min, mean, max (cycles), fpu errors\n");
+
+    bench_round("int", task_int_worker);
+    bench_round("fpu", task_fpu_worker);
+
+    SEGGER_RTT_printf(0, "[sched_bench_fpu] done\n");
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    dwt_cyccnt_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
@@ -0,0 +1,244 @@
+/**
+ * @file    sched_bench_irq_latency.c
+ * @brief   中断屏蔽窗口基准测试：高优先级中断延迟 (PRIMASK vs BASEPRI 临界区)
+ *
+ * 测试方法：
+ * 1. TIM2 以 ~10 kHz 产生更新中断，优先级 BENCH_TIMER_IRQ_PRIORITY 高于
+ *    SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY (不调用内核)
+ * 2. 中断入口读取 TIM2->CNT：计数器在更新事件时归零，读数即为
+ *    "中断请求 -> 处理函数执行" 的延迟
+ * 3. 负载任务持续执行临界区较长的内核操作 (创建/删除任务、队列收发、
+ *    栈区统计)，SysTick 与 PendSV 同时运行
+ * 4. 每轮 BENCH_ROUND_TICKS 输出样本数、最大延迟与直方图 (CPU 周期)
+ *
+ * 对比方法：
+ *   cmake ... -DSCHED_MAX_SYSCALL_INTERRUPT_PRIORITY=0   # PRIMASK，临界区屏蔽全部中断
+ *   cmake ...                                            # BASEPRI (默认 5)
+ *
+ * 期望结果：PRIMASK 时最大延迟约等于最长临界区；BASEPRI 时最大延迟
+ * 只剩硬件入栈与 Flash 等待，与内核负载无关。
+ */
+
+#include "scheduler.h"
+#include "sched_queue.h"
+#include "board.h"
+#include "board_config.h"  /* CMSIS: NVIC / TIM2 */
+#include "bench_common.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_LOAD_PRIORITY       1
+#define BENCH_CTRL_PRIORITY       (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS         1000   /* 每轮测量时长 (ms) */
+#define BENCH_ROUNDS              5
+#define BENCH_TIMER_RATE_HZ       9973   /* 与 SysTick 不成整数倍，采样点遍布各临界区 */
+#define BENCH_TIMER_IRQ_PRIORITY  2      /* 高于 SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY */
+#define BENCH_HIST_BUCKETS        8      /* <16, <32, ... <1024, >=1024 周期 */
+
+/* 两块板 TIM2 时钟均为 SystemCoreClock / 2 (F4: 84 MHz, H7: 200 MHz) */
+#define BENCH_CPU_CYCLES_PER_TIMER_TICK  2
+
+#if SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY > 0 && \
+    BENCH_TIMER_IRQ_PRIORITY >= SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY
+#error "BENCH_TIMER_IRQ_PRIORITY 必须高于 SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t count;
+    uint32_t max;
+    uint32_t hist[BENCH_HIST_BUCKETS];
+} bench_latency_t;
+
+static volatile bench_latency_t g_latency;
+
+typedef struct {
+    uint32_t seq;
+    uint8_t  payload[28];
+} bench_msg_t;
+
+static bench_msg_t   g_msg_buf[8];
+static sched_queue_t g_msg_queue;
+
+static void bench_timer_init(void)
+{
+#if defined(STM32H743xx)
+    RCC->APB1LENR |= RCC_APB1LENR_TIM2EN;
+    (void)RCC->APB1LENR;  /* 等待时钟使能生效 */
+#else
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+    (void)RCC->APB1ENR;   /* 等待时钟使能生效 */
+#endif
+
+    uint32_t timer_clock = SystemCoreClock / BENCH_CPU_CYCLES_PER_TIMER_TICK;
+
+    TIM2->CR1 = 0;
+    TIM2->PSC = 0;
+    TIM2->ARR = timer_clock / BENCH_TIMER_RATE_HZ - 1U;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->SR = 0;
+    TIM2->DIER = TIM_DIER_UIE;
+
+    NVIC_SetPriority(TIM2_IRQn, BENCH_TIMER_IRQ_PRIORITY);
+    NVIC_EnableIRQ(TIM2_IRQn);
+
+    TIM2->CR1 = TIM_CR1_CEN;
+}
+
+/* ========================================================================
+ * 中断处理 (不调用任何内核 API)
+ * ======================================================================== */
+
+void TIM2_IRQHandler(void)
+{
+    uint32_t cycles = TIM2->CNT * BENCH_CPU_CYCLES_PER_TIMER_TICK;
+    TIM2->SR = ~TIM_SR_UIF;
+
+    uint32_t bucket = 0;
+    while (bucket < BENCH_HIST_BUCKETS - 1U && cycles >= (16UL << bucket)) {
+        bucket++;
+    }
+
+    g_latency.hist[bucket]++;
+    g_latency.count++;
+    if (cycles > g_latency.max) {
+        g_latency.max = cycles;
+    }
+}
+
+/* ========================================================================
+ * 负载任务
+ * ======================================================================== */
+
+static void task_short_lived(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/**
+ * 栈区负载：反复创建/删除任务并统计栈区 (最佳适配搜索、合并都在临界区内)
+ */
+static void task_arena_load(void *param)
+{
+    (void)param;
+
+    sched_stack_arena_info_t info;
+
+    while (1) {
+        task_handle_t t = sched_task_create(task_short_lived, "Tmp", 2048, NULL, 0);
+        sched_get_stack_arena_info(&info);
+        if (t) {
+            sched_task_delete(t);
+        }
+        sched_yield();
+    }
+}
+
+/**
+ * 队列负载：收发 32 字节消息 (拷贝在临界区内)
+ */
+static void task_queue_producer(void *param)
+{
+    (void)param;
+
+    bench_msg_t msg = {0};
+
+    while (1) {
+        msg.seq++;
+        sched_queue_send(&g_msg_queue, &msg, SCHED_WAIT_FOREVER);
+    }
+}
+
+static void task_queue_consumer(void *param)
+{
+    (void)param;
+
+    bench_msg_t msg;
+
+    while (1) {
+        sched_queue_receive(&g_msg_queue, &msg, SCHED_WAIT_FOREVER);
+    }
+}
+
+/**
+ * 控制任务：每轮输出延迟统计
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_irq_latency] max syscall priority %u (%s)\n",
+                      (unsigned)SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY,
+                      SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY ? "BASEPRI" : "PRIMASK");
+    SEGGER_RTT_printf(0, "round, samples, max, <16, <32, <64, <128, <256, <512, <1024, >=1024 (cycles)\n");
+
+    bench_timer_init();
+
+    for (uint32_t round = 1; round <= BENCH_ROUNDS; round++) {
+        /* 只关 TIM2 中断访问统计，避免测量代码本身引入屏蔽窗口 */
+        NVIC_DisableIRQ(TIM2_IRQn);
+        for (uint32_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+            g_latency.hist[i] = 0;
+        }
+        g_latency.count = 0;
+        g_latency.max = 0;
+        NVIC_EnableIRQ(TIM2_IRQn);
+
+        sched_delay(BENCH_ROUND_TICKS);
+
+        NVIC_DisableIRQ(TIM2_IRQn);
+        bench_latency_t result;
+        result.count = g_latency.count;
+        result.max = g_latency.max;
+        for (uint32_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+            result.hist[i] = g_latency.hist[i];
+        }
+        NVIC_EnableIRQ(TIM2_IRQn);
+
+        SEGGER_RTT_printf(0, "%u, %u, %u", (unsigned)round,
+                          (unsigned)result.count, (unsigned)result.max);
+        for (uint32_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+            SEGGER_RTT_printf(0, ", %u", (unsigned)result.hist[i]);
+        }
+        SEGGER_RTT_printf(0, "\n");
+    }
+
+    NVIC_DisableIRQ(TIM2_IRQn);
+    SEGGER_RTT_printf(0, "[sched_bench_irq_latency] done\n");
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    dwt_cyccnt_init();
+
+    sched_init();
+    sched_queue_init(&g_msg_queue, g_msg_buf, sizeof(bench_msg_t), 8);
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_arena_load, "Arena", 512, NULL, BENCH_LOAD_PRIORITY);
+    sched_task_create(task_queue_producer, "QProd", 512, NULL, BENCH_LOAD_PRIORITY);
+    sched_task_create(task_queue_consumer, "QCons", 512, NULL, BENCH_LOAD_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
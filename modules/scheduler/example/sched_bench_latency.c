@@ -0,0 +1,482 @@
+/**
+ * @file    sched_bench_latency.c
+ * @brief   调度器延迟基准测试套件：切换 / 中断唤醒 / 滴答开销 / 延时抖动
+ *
+ * 测试项 (每项运行 BENCH_ROUND_TICKS 个滴答)：
+ * 1. switch:     两个同优先级任务循环 sched_yield()，"yield -> 下一任务恢复" 的周期数
+ * 2. irq_entry:  任务挂起软件中断 (EXTI0) -> 中断处理函数入口
+ *    isr_wake:   中断中 sched_task_notify_from_isr() -> 被唤醒的高优先级任务恢复
+ * 3. tick:       周期窃取法测量 SysTick 处理耗时 (延时链表中有 BENCH_SLEEPERS 个任务)
+ * 4. delay:      sched_delay(1) 连续两次唤醒的间隔
+ *    jitter:     上述间隔与一个滴答周期之差的绝对值
+ *
+ * 每项输出 samples, min, mean, max 与 log2 直方图 (<32, <64, ... <2048, >=2048 周期)。
+ *
+ * 硬件：DWT CYCCNT 计时，RTT 通道 0 输出 (F407 与 H743 均可构建，便于对比)。
+ * QEMU：-DSCHED_BENCH_QEMU=ON (仅 stm32f407zg)，QEMU 不模拟 DWT，改用 SysTick 当前值
+ * 拼接滴答数计时；结果经半主机输出，测试结束后退出 QEMU：
+ *   qemu-system-arm -M netduinoplus2 -nographic -icount shift=0 \
+ *       -semihosting-config enable=on,target=native -kernel sched_bench_latency
+ * QEMU 的计时来自虚拟时钟而非真实流水线，只用于比较内核改动前后的相对变化。
+ */
+
+#include "scheduler.h"
+#include "board.h"
+#include "board_config.h"  /* CMSIS: DWT / SysTick / NVIC */
+#include "SEGGER_RTT.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#ifndef SCHED_BENCH_QEMU
+#define SCHED_BENCH_QEMU          0
+#endif
+
+#define BENCH_WORKER_PRIORITY     1
+#define BENCH_WAITER_PRIORITY     2
+#define BENCH_PROBE_PRIORITY      1        /* 高于空闲任务，独占空闲周期 */
+#define BENCH_CTRL_PRIORITY       (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_DELAY_PRIORITY      (SCHED_MAX_PRIORITIES - 2)
+#define BENCH_ROUND_TICKS         500      /* 每项测量时长 (滴答) */
+#define BENCH_SLEEPERS            8        /* tick 测试时延时链表中的任务数 */
+#define BENCH_SLEEP_TICKS         60000    /* 休眠任务延时，远大于测量时长 */
+#define BENCH_GAP_THRESHOLD       30       /* 周期窃取：判定为中断的最小间隔 (周期) */
+#define BENCH_HIST_BUCKETS        8
+#define BENCH_HIST_BASE           32       /* 第一个直方图桶上界 (周期) */
+
+/* 软件触发的中断 (两块板都未使用 EXTI0)，优先级允许调用内核 */
+#define BENCH_IRQn                EXTI0_IRQn
+#define BENCH_IRQ_PRIORITY        (SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY + 1)
+
+/* ========================================================================
+ * 计时与输出
+ * ======================================================================== */
+
+#if SCHED_BENCH_QEMU
+/**
+ * SysTick 当前值 + 滴答数拼接的单调计数 (单位：SysTick 时钟周期)
+ *
+ * 读取期间发生滴答时重读；在屏蔽 SysTick 的上下文中跨越重装载点会回退一个周期，
+ * 这类样本在统计时按无效样本丢弃。
+ */
+static uint32_t bench_now(void)
+{
+    uint32_t reload = SysTick->LOAD + 1U;
+    uint32_t tick;
+    uint32_t val;
+
+    do {
+        tick = sched_get_tick_count();
+        val = SysTick->VAL;
+    } while (tick != sched_get_tick_count());
+
+    return tick * reload + (reload - 1U - val);
+}
+
+static void bench_timer_init(void)
+{
+}
+
+/**
+ * 半主机调用 (ARM semihosting，bkpt 0xAB)
+ */
+static int semihosting_call(int op, const void *arg)
+{
+    register int r0 __asm("r0") = op;
+    register const void *r1 __asm("r1") = arg;
+
+    __asm volatile ("bkpt 0xAB" : "+r" (r0) : "r" (r1) : "memory");
+    return r0;
+}
+
+#define SEMIHOSTING_SYS_WRITE0          0x04
+#define SEMIHOSTING_SYS_EXIT            0x18
+#define SEMIHOSTING_APPLICATION_EXIT    0x20026
+
+static void bench_write(const char *text)
+{
+    semihosting_call(SEMIHOSTING_SYS_WRITE0, text);
+}
+
+static void bench_exit(void)
+{
+    semihosting_call(SEMIHOSTING_SYS_EXIT, (const void *)SEMIHOSTING_APPLICATION_EXIT);
+}
+#else
+static inline uint32_t bench_now(void)
+{
+    return DWT->CYCCNT;
+}
+
+static void bench_timer_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if defined(STM32H743xx)
+    DWT->LAR = 0xC5ACCE55;  /* Cortex-M7 需要解锁 DWT */
+#endif
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static void bench_write(const char *text)
+{
+    SEGGER_RTT_WriteString(0, text);
+}
+
+static void bench_exit(void)
+{
+}
+#endif
+
+static void bench_printf(const char *fmt, ...)
+{
+    char line[160];
+    va_list args;
+
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+
+    bench_write(line);
+}
+
+/* ========================================================================
+ * 统计
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t count;
+    uint32_t hist[BENCH_HIST_BUCKETS];
+} bench_stat_t;
+
+static void bench_stat_reset(bench_stat_t *st)
+{
+    st->min = UINT32_MAX;
+    st->max = 0;
+    st->sum = 0;
+    st->count = 0;
+    for (uint32_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        st->hist[i] = 0;
+    }
+}
+
+static void bench_stat_add(bench_stat_t *st, uint32_t cycles)
+{
+    /* 计时回退 (见 bench_now) 表现为接近 2^32 的值，丢弃 */
+    if ((int32_t)cycles < 0) {
+        return;
+    }
+
+    uint32_t bucket = 0;
+    while (bucket < BENCH_HIST_BUCKETS - 1U && cycles >= ((uint32_t)BENCH_HIST_BASE << bucket)) {
+        bucket++;
+    }
+
+    if (cycles < st->min) st->min = cycles;
+    if (cycles > st->max) st->max = cycles;
+    st->sum += cycles;
+    st->count++;
+    st->hist[bucket]++;
+}
+
+static void bench_stat_print(const char *label, const bench_stat_t *st)
+{
+    uint32_t mean = st->count ? (uint32_t)(st->sum / st->count) : 0;
+    uint32_t min = st->count ? st->min : 0;
+
+    bench_printf("%-9s, %6lu, %6lu, %6lu, %6lu", label, (unsigned long)st->count,
+                 (unsigned long)min, (unsigned long)mean, (unsigned long)st->max);
+    for (uint32_t i = 0; i < BENCH_HIST_BUCKETS; i++) {
+        bench_printf(", %lu", (unsigned long)st->hist[i]);
+    }
+    bench_printf("\n");
+}
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+static bench_stat_t      g_stat_a;
+static bench_stat_t      g_stat_b;
+static volatile bool     g_enable;        /* 当前测试项正在采样 */
+static volatile bool     g_stamp_valid;   /* 时间戳有效 (排除跨轮次的样本) */
+static volatile uint32_t g_stamp;         /* 最近一次 yield / 挂起中断前的时间戳 */
+static volatile uint32_t g_isr_stamp;     /* 中断入口时间戳 */
+static task_handle_t     g_waiter;
+
+/**
+ * 开始一项测量：清空统计后运行 BENCH_ROUND_TICKS
+ */
+static void bench_run_round(void)
+{
+    sched_enter_critical();
+    bench_stat_reset(&g_stat_a);
+    bench_stat_reset(&g_stat_b);
+    g_stamp_valid = false;
+    g_enable = true;
+    sched_exit_critical();
+
+    sched_delay(BENCH_ROUND_TICKS);
+
+    /* 控制任务优先级最高，运行期间被测任务不会修改统计 */
+    g_enable = false;
+}
+
+/* ========================================================================
+ * 1. yield 切换
+ * ======================================================================== */
+
+static void task_switch_worker(void *param)
+{
+    (void)param;
+
+    while (1) {
+        uint32_t now = bench_now();
+
+        if (g_enable && g_stamp_valid) {
+            bench_stat_add(&g_stat_a, now - g_stamp);
+        }
+
+        g_stamp_valid = true;
+        g_stamp = bench_now();
+        sched_yield();
+    }
+}
+
+static void bench_switch(void)
+{
+    task_handle_t a = sched_task_create(task_switch_worker, "SwitchA", 512, NULL,
+                                        BENCH_WORKER_PRIORITY);
+    task_handle_t b = sched_task_create(task_switch_worker, "SwitchB", 512, NULL,
+                                        BENCH_WORKER_PRIORITY);
+
+    bench_run_round();
+
+    sched_task_delete(a);
+    sched_task_delete(b);
+
+    bench_stat_print("switch", &g_stat_a);
+}
+
+/* ========================================================================
+ * 2. 中断 -> 任务唤醒
+ * ======================================================================== */
+
+void EXTI0_IRQHandler(void)
+{
+    bool woken = false;
+
+    g_isr_stamp = bench_now();
+
+    if (g_enable && g_stamp_valid) {
+        bench_stat_add(&g_stat_a, g_isr_stamp - g_stamp);
+    }
+
+    sched_task_notify_from_isr(g_waiter, 0, SCHED_NOTIFY_INCREMENT, &woken);
+    sched_yield_from_isr(woken);
+}
+
+static void task_isr_waiter(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_task_notify_take(true, SCHED_WAIT_FOREVER);
+
+        uint32_t now = bench_now();
+        if (g_enable && g_stamp_valid) {
+            bench_stat_add(&g_stat_b, now - g_isr_stamp);
+        }
+    }
+}
+
+static void task_isr_trigger(void *param)
+{
+    (void)param;
+
+    while (1) {
+        g_stamp_valid = true;
+        g_stamp = bench_now();
+        NVIC_SetPendingIRQ(BENCH_IRQn);
+
+        /* 等待者优先级更高：到这里时它已处理完并重新阻塞 */
+    }
+}
+
+static void bench_isr_wakeup(void)
+{
+    NVIC_SetPriority(BENCH_IRQn, BENCH_IRQ_PRIORITY);
+    NVIC_ClearPendingIRQ(BENCH_IRQn);
+    NVIC_EnableIRQ(BENCH_IRQn);
+
+    g_waiter = sched_task_create(task_isr_waiter, "IsrWaiter", 512, NULL, BENCH_WAITER_PRIORITY);
+    task_handle_t trigger = sched_task_create(task_isr_trigger, "IsrTrigger", 512, NULL,
+                                              BENCH_WORKER_PRIORITY);
+
+    bench_run_round();
+
+    sched_task_delete(trigger);
+    NVIC_DisableIRQ(BENCH_IRQn);
+    sched_task_delete(g_waiter);
+
+    bench_stat_print("irq_entry", &g_stat_a);
+    bench_stat_print("isr_wake", &g_stat_b);
+}
+
+/* ========================================================================
+ * 3. 滴答处理开销 (周期窃取法)
+ * ======================================================================== */
+
+static void task_sleeper(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_delay(BENCH_SLEEP_TICKS);
+    }
+}
+
+static void task_probe(void *param)
+{
+    (void)param;
+
+    uint32_t last = bench_now();
+
+    while (1) {
+        uint32_t now = bench_now();
+        uint32_t gap = now - last;
+
+        if (g_enable && gap > BENCH_GAP_THRESHOLD) {
+            bench_stat_add(&g_stat_a, gap);
+        }
+
+        last = now;
+    }
+}
+
+static void bench_tick(void)
+{
+    task_handle_t sleepers[BENCH_SLEEPERS];
+    uint32_t created = 0;
+
+    for (uint32_t i = 0; i < BENCH_SLEEPERS; i++) {
+        sleepers[i] = sched_task_create(task_sleeper, "Sleeper", 256, NULL, BENCH_WAITER_PRIORITY);
+        if (sleepers[i] == NULL) break;
+        created++;
+    }
+
+    task_handle_t probe = sched_task_create(task_probe, "Probe", 256, NULL, BENCH_PROBE_PRIORITY);
+
+    /* 先让休眠任务全部进入延时链表 */
+    sched_delay(10);
+
+    bench_run_round();
+
+    sched_task_delete(probe);
+    for (uint32_t i = 0; i < created; i++) {
+        sched_task_delete(sleepers[i]);
+    }
+
+    bench_stat_print("tick", &g_stat_a);
+}
+
+/* ========================================================================
+ * 4. sched_delay 抖动
+ * ======================================================================== */
+
+static void task_delay_probe(void *param)
+{
+    (void)param;
+
+    uint32_t cycles_per_tick = SysTick->LOAD + 1U;
+    uint32_t last = bench_now();
+
+    while (1) {
+        sched_delay(1);
+
+        uint32_t now = bench_now();
+        uint32_t interval = now - last;
+        last = now;
+
+        if (g_enable && g_stamp_valid) {
+            bench_stat_add(&g_stat_a, interval);
+            bench_stat_add(&g_stat_b, (interval > cycles_per_tick) ? interval - cycles_per_tick
+                                                                   : cycles_per_tick - interval);
+        }
+        g_stamp_valid = true;
+    }
+}
+
+static void bench_delay_jitter(void)
+{
+    task_handle_t probe = sched_task_create(task_delay_probe, "DelayProbe", 512, NULL,
+                                            BENCH_DELAY_PRIORITY);
+
+    bench_run_round();
+
+    sched_task_delete(probe);
+
+    bench_stat_print("delay", &g_stat_a);
+    bench_stat_print("jitter", &g_stat_b);
+}
+
+/* ========================================================================
+ * 控制任务
+ * ======================================================================== */
+
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    bench_printf("\n[sched_bench_latency] %s, core clock %lu Hz, tick %lu cycles\n",
+                 SCHED_BENCH_QEMU ? "qemu (SysTick timer)" : "hardware (DWT)",
+                 (unsigned long)SystemCoreClock, (unsigned long)(SysTick->LOAD + 1U));
+    bench_printf("test, samples, min, mean, max (cycles), <32, <64, <128, <256, <512, <1024, <2048, >=2048\n");
+
+    bench_switch();
+    bench_isr_wakeup();
+    bench_tick();
+    bench_delay_jitter();
+
+    bench_printf("[sched_bench_latency] done\n");
+    bench_exit();
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+static void task_idle(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_idle_sleep();
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    bench_timer_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_idle, "Idle", 256, NULL, 0);
+
+    sched_start();
+
+    while (1);
+}
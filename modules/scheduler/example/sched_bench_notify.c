@@ -0,0 +1,195 @@
+/**
+ * @file    sched_bench_notify.c
+ * @brief   任务通知基准测试：任务通知 vs 计数信号量的唤醒开销
+ *
+ * 测试方法：
+ * 1. API 开销：控制任务对自身执行 give+take (不发生切换)，DWT CYCCNT 计时
+ * 2. 唤醒延迟：低优先级发送任务记录时间戳后 give，高优先级等待任务
+ *    在 take 返回后计算 "give -> 等待者恢复" 的周期数
+ * 3. 每轮运行 BENCH_ROUND_TICKS 后统计 min/mean/max，经 RTT 输出
+ *
+ * 期望结果：任务通知无需额外对象和等待链表，唤醒延迟低于信号量，
+ * RAM 占用为每任务 5 字节 (信号量每个对象 sizeof(sched_sem_t))。
+ */
+
+#include "scheduler.h"
+#include "sched_sync.h"
+#include "board.h"
+#include "bench_common.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_SIGNAL_PRIORITY   1
+#define BENCH_WAITER_PRIORITY   2
+#define BENCH_CTRL_PRIORITY     (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS       200    /* 每轮测量时长 (ms) */
+#define BENCH_API_LOOPS         1000   /* API 开销测量次数 */
+
+typedef enum {
+    BENCH_MODE_SEM = 0,
+    BENCH_MODE_NOTIFY
+} bench_mode_t;
+
+static const char *const g_mode_name[] = { "sem", "notify" };
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+static volatile bench_mode_t g_mode;
+static volatile uint32_t     g_give_stamp;   /* 最近一次 give 前的 CYCCNT */
+static volatile bool         g_stamp_valid;  /* 时间戳有效 (排除被 tick 打断的样本) */
+static bench_stat_t          g_stat;
+static sched_sem_t           g_sem;
+static task_handle_t         g_waiter;
+
+static void bench_stat_print(const char *label, const bench_stat_t *st)
+{
+    uint32_t mean = st->count ? (uint32_t)(st->sum / st->count) : 0;
+    SEGGER_RTT_printf(0, "%s, %s, %u, %u, %u\n", label, g_mode_name[g_mode],
+                      (unsigned)st->min, (unsigned)mean, (unsigned)st->max);
+}
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+/**
+ * 等待任务：阻塞等待，恢复后记录 give -> 恢复的周期数
+ */
+static void task_waiter(void *param)
+{
+    (void)param;
+
+    while (1) {
+        if (g_mode == BENCH_MODE_SEM) {
+            sched_sem_take(&g_sem, SCHED_WAIT_FOREVER);
+        } else {
+            sched_task_notify_take(true, SCHED_WAIT_FOREVER);
+        }
+
+        uint32_t now = DWT->CYCCNT;
+        if (g_stamp_valid) {
+            bench_stat_add(&g_stat, now - g_give_stamp);
+        }
+        g_stamp_valid = false;
+    }
+}
+
+/**
+ * 发送任务：记录时间戳后唤醒等待任务 (等待任务优先级更高，立即抢占)
+ */
+static void task_signal(void *param)
+{
+    (void)param;
+
+    while (1) {
+        g_stamp_valid = true;
+        g_give_stamp = DWT->CYCCNT;
+
+        if (g_mode == BENCH_MODE_SEM) {
+            sched_sem_give(&g_sem);
+        } else {
+            sched_task_notify(g_waiter, 0, SCHED_NOTIFY_INCREMENT);
+        }
+    }
+}
+
+/**
+ * 测量不发生切换的 give+take 开销
+ */
+static void bench_api_cost(void)
+{
+    task_handle_t self = sched_get_current_task();
+
+    bench_stat_reset(&g_stat);
+
+    for (uint32_t i = 0; i < BENCH_API_LOOPS; i++) {
+        uint32_t start = DWT->CYCCNT;
+
+        if (g_mode == BENCH_MODE_SEM) {
+            sched_sem_give(&g_sem);
+            sched_sem_take(&g_sem, 0);
+        } else {
+            sched_task_notify(self, 0, SCHED_NOTIFY_INCREMENT);
+            sched_task_notify_take(true, 0);
+        }
+
+        bench_stat_add(&g_stat, DWT->CYCCNT - start);
+    }
+
+    bench_stat_print("api", &g_stat);
+}
+
+/**
+ * 测量跨任务唤醒延迟
+ */
+static void bench_wakeup_latency(void)
+{
+    g_waiter = sched_task_create(task_waiter, "Waiter", 512, NULL, BENCH_WAITER_PRIORITY);
+    task_handle_t signal = sched_task_create(task_signal, "Signal", 512, NULL,
+                                             BENCH_SIGNAL_PRIORITY);
+
+    sched_enter_critical();
+    bench_stat_reset(&g_stat);
+    g_stamp_valid = false;
+    sched_exit_critical();
+
+    sched_delay(BENCH_ROUND_TICKS);
+
+    /* 冻结统计：控制任务运行期间其他任务不会执行 */
+    bench_stat_t result = g_stat;
+
+    sched_task_delete(signal);
+    sched_task_delete(g_waiter);
+
+    bench_stat_print("wakeup", &result);
+}
+
+/**
+ * 控制任务：依次测量信号量和任务通知
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_notify] test, mode, min, mean, max (cycles)\n");
+
+    for (uint32_t mode = BENCH_MODE_SEM; mode <= BENCH_MODE_NOTIFY; mode++) {
+        g_mode = (bench_mode_t)mode;
+        sched_sem_init(&g_sem, 0, UINT32_MAX);
+
+        bench_api_cost();
+        bench_wakeup_latency();
+    }
+
+    SEGGER_RTT_printf(0, "ram, sem object %u bytes, notify %u bytes per task\n",
+                      (unsigned)sizeof(sched_sem_t),
+                      (unsigned)(sizeof(uint32_t) + sizeof(uint8_t)));
+    SEGGER_RTT_printf(0, "[sched_bench_notify] done\n");
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    dwt_cyccnt_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
@@ -0,0 +1,180 @@
+/**
+ * @file    sched_bench_periodic.c
+ * @brief   周期任务基准测试：同优先级任务集的截止期错失 (时间片轮转 vs EDF)
+ *
+ * 测试方法：
+ * 1. 同一优先级创建一组周期任务 (周期 P, 每个作业忙等 C 个滴答, 截止期 = 周期)，
+ *    作业结束调用 sched_task_wait_next_period()
+ * 2. 每轮运行 BENCH_ROUND_TICKS，输出每个任务完成的作业数与截止期错失次数
+ * 3. 第一轮利用率约 83%，第二轮加入一个任务使利用率超过 100%
+ *
+ * 对比方法：
+ *   cmake ...                    # 同优先级时间片轮转
+ *   cmake ... -DSCHED_USE_EDF=ON # 同优先级按截止期调度
+ *
+ * 期望结果：利用率 < 100% 时 EDF 无错失，轮转 (时间片 10 滴答长于最短周期) 持续错失；
+ * 利用率 > 100% 时两种模式都出现错失，可作为 CPU 负载饱和的预警。
+ *
+ * 硬件上 RTT 通道 0 输出；BOARD=posix 时 printf 输出后退出。
+ * 主机上请加 -DSCHED_POSIX_VIRTUAL_TIME=ON：作业耗时按滴答精确模拟，结果可复现。
+ * 实时模式下作业靠墙钟滴答忙等，主机调度抖动计入作业耗时，EDF 也会出现少量错失。
+ */
+
+#include "scheduler.h"
+#include "board.h"
+
+#if defined(BOARD_POSIX)
+#include "port_posix.h"
+#include <stdio.h>
+#include <stdlib.h>
+#define bench_printf(...)  printf(__VA_ARGS__)
+#define bench_exit()       exit(0)
+#else
+#include "SEGGER_RTT.h"
+#define bench_printf(...)  SEGGER_RTT_printf(0, __VA_ARGS__)
+#define bench_exit()       do { } while (0)
+#endif
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_TASK_PRIORITY       2
+#define BENCH_CTRL_PRIORITY       (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS         5000   /* 每轮测量时长 (滴答) */
+
+typedef struct {
+    sched_tick_t  period;          /* 周期 (滴答) */
+    sched_tick_t  cost;            /* 每个作业忙等的滴答数 */
+    uint32_t      jobs;            /* 完成的作业数 */
+    task_handle_t handle;
+} bench_periodic_t;
+
+/* 前 3 个任务利用率 1/4 + 2/6 + 3/12 = 83%，第 4 个任务再加 25% */
+static bench_periodic_t g_tasks[] = {
+    { .period = 4,  .cost = 1 },
+    { .period = 6,  .cost = 2 },
+    { .period = 12, .cost = 3 },
+    { .period = 8,  .cost = 2 },
+};
+
+#define BENCH_TASK_COUNT          (sizeof(g_tasks) / sizeof(g_tasks[0]))
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+/**
+ * 忙等指定滴答数 (被抢占期间错过的滴答只计 1 个，近似占用 CPU 的时间)
+ *
+ * 经临界区读取滴答：POSIX 移植层只在内核边界处理模拟中断，纯计算循环不会被抢占
+ */
+static void burn_ticks(sched_tick_t ticks)
+{
+#if defined(BOARD_POSIX) && SCHED_POSIX_VIRTUAL_TIME
+    /* 虚拟时间：逐个滴答推进，被抢占期间不计入 */
+    port_posix_consume_ticks(ticks);
+#else
+    sched_tick_t last = sched_get_tick_count();
+
+    while (ticks > 0) {
+        sched_enter_critical();
+        sched_tick_t now = sched_get_tick_count();
+        sched_exit_critical();
+
+        if (now != last) {
+            last = now;
+            ticks--;
+        }
+    }
+#endif
+}
+
+static void task_periodic(void *param)
+{
+    bench_periodic_t *st = (bench_periodic_t *)param;
+
+    while (1) {
+        burn_ticks(st->cost);
+        st->jobs++;
+        sched_task_wait_next_period();
+    }
+}
+
+static void task_idle(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_idle_sleep();
+    }
+}
+
+/* ========================================================================
+ * 测量
+ * ======================================================================== */
+
+static void bench_round(uint32_t task_count)
+{
+    uint32_t load_pct = 0;
+
+    for (uint32_t i = 0; i < task_count; i++) {
+        g_tasks[i].jobs = 0;
+        g_tasks[i].handle = sched_task_create_periodic(task_periodic, "Periodic", 512, &g_tasks[i],
+                                                       BENCH_TASK_PRIORITY, g_tasks[i].period, 0);
+        load_pct += (uint32_t)(g_tasks[i].cost * 100U / g_tasks[i].period);
+    }
+
+    sched_delay(BENCH_ROUND_TICKS);
+
+    /* 控制任务优先级最高，运行期间周期任务不会修改统计 */
+    uint32_t total_misses = 0;
+
+    bench_printf("tasks %u, load ~%u%%\n", (unsigned)task_count, (unsigned)load_pct);
+    bench_printf("period, cost, jobs, deadline misses\n");
+    for (uint32_t i = 0; i < task_count; i++) {
+        uint32_t misses = sched_task_get_deadline_misses(g_tasks[i].handle);
+        total_misses += misses;
+
+        bench_printf("%u, %u, %u, %u\n", (unsigned)g_tasks[i].period, (unsigned)g_tasks[i].cost,
+                     (unsigned)g_tasks[i].jobs, (unsigned)misses);
+        sched_task_delete(g_tasks[i].handle);
+    }
+    bench_printf("total misses, %u\n", (unsigned)total_misses);
+}
+
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    bench_printf("\n[sched_bench_periodic] %s, %u ticks per round\n",
+                 SCHED_USE_EDF ? "EDF" : "round-robin", (unsigned)BENCH_ROUND_TICKS);
+
+    bench_round(BENCH_TASK_COUNT - 1);
+    bench_round(BENCH_TASK_COUNT);
+
+    bench_printf("[sched_bench_periodic] done\n");
+    bench_exit();
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_idle, "Idle", 256, NULL, 0);
+
+    sched_start();
+
+    while (1);
+}
@@ -0,0 +1,225 @@
+/**
+ * @file    sched_bench_posix.c
+ * @brief   POSIX 主机基准测试：切换吞吐 + 周期任务唤醒延迟 (BOARD=posix)
+ *
+ * 测试方法：
+ * 1. 往返吞吐：两个同优先级任务用任务通知互相唤醒 BENCH_PINGPONG_ROUNDS 次
+ *    (每次往返 2 次切换)，主机 CLOCK_MONOTONIC 计时，输出每次切换的纳秒数
+ * 2. 周期唤醒：不同周期的任务按 "下一次到期时刻" 延时，记录唤醒时刻相对
+ *    到期时刻的滞后 (滴答)，并把 (滴答, 任务) 唤醒顺序折叠成摘要值
+ * 3. 结果 printf 输出后进程退出，可直接用于脚本对比
+ *
+ * 对比方法：
+ *   cmake -S . -B build-posix -DBOARD=posix -DBUILD_SCHEDULER_EXAMPLE=ON
+ *   cmake ... -DSCHED_POSIX_VIRTUAL_TIME=ON   # 虚拟时间
+ *
+ * 期望结果：虚拟时间模式下滞后恒为 0，唤醒顺序摘要每次运行都相同；
+ * 实时模式下滞后与摘要反映主机调度抖动。切换纳秒数是主机线程切换开销，
+ * 只用于比较内核改动前后的相对变化，不代表 MCU 上的周期数。
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "scheduler.h"
+#include "board.h"
+#include "port_posix.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_WORKER_PRIORITY     2
+#define BENCH_CTRL_PRIORITY       (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_PINGPONG_ROUNDS     100000
+#define BENCH_PERIODIC_TICKS      10000  /* 周期唤醒测量时长 (滴答) */
+
+static const sched_tick_t g_periods[] = { 1, 3, 7, 10 };
+
+#define BENCH_PERIODIC_TASKS      (sizeof(g_periods) / sizeof(g_periods[0]))
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t wakeups;
+    uint32_t max_lateness;  /* 唤醒时刻相对到期时刻的最大滞后 (滴答) */
+    uint64_t sum_lateness;
+} bench_periodic_t;
+
+static task_handle_t    g_ctrl;
+static task_handle_t    g_ping;
+static task_handle_t    g_pong;
+static bench_periodic_t g_periodic[BENCH_PERIODIC_TASKS];
+static uint32_t         g_order_hash;  /* 唤醒顺序摘要 (FNV-1a) */
+
+static uint64_t host_now_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void order_hash_add(uint32_t value)
+{
+    for (uint32_t i = 0; i < 4; i++) {
+        g_order_hash ^= (value >> (i * 8U)) & 0xFFU;
+        g_order_hash *= 16777619UL;
+    }
+}
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+static void task_ping(void *param)
+{
+    (void)param;
+
+    for (uint32_t i = 0; i < BENCH_PINGPONG_ROUNDS; i++) {
+        sched_task_notify(g_pong, 0, SCHED_NOTIFY_INCREMENT);
+        sched_task_notify_take(true, SCHED_WAIT_FOREVER);
+    }
+
+    sched_task_notify(g_ctrl, 0, SCHED_NOTIFY_INCREMENT);
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+static void task_pong(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_task_notify_take(true, SCHED_WAIT_FOREVER);
+        sched_task_notify(g_ping, 0, SCHED_NOTIFY_INCREMENT);
+    }
+}
+
+/**
+ * 周期任务：按绝对到期时刻延时，记录唤醒滞后
+ */
+static void task_periodic(void *param)
+{
+    uint32_t index = (uint32_t)(uintptr_t)param;
+    bench_periodic_t *st = &g_periodic[index];
+    sched_tick_t next = sched_get_tick_count();
+
+    while (1) {
+        next += g_periods[index];
+
+        int32_t remain = (int32_t)(next - sched_get_tick_count());
+        if (remain > 0) {
+            sched_delay((sched_tick_t)remain);
+        }
+
+        sched_tick_t now = sched_get_tick_count();
+        uint32_t lateness = (uint32_t)(now - next);
+
+        st->wakeups++;
+        st->sum_lateness += lateness;
+        if (lateness > st->max_lateness) {
+            st->max_lateness = lateness;
+        }
+
+        order_hash_add((now << 4) | index);
+    }
+}
+
+static void task_idle(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_idle_sleep();
+    }
+}
+
+/* ========================================================================
+ * 测量
+ * ======================================================================== */
+
+static void bench_pingpong(void)
+{
+    g_ping = sched_task_create(task_ping, "Ping", 512, NULL, BENCH_WORKER_PRIORITY);
+    g_pong = sched_task_create(task_pong, "Pong", 512, NULL, BENCH_WORKER_PRIORITY);
+
+    uint64_t start = host_now_ns();
+    sched_task_notify_take(true, SCHED_WAIT_FOREVER);
+    uint64_t elapsed = host_now_ns() - start;
+
+    sched_task_delete(g_ping);
+    sched_task_delete(g_pong);
+
+    printf("pingpong, %u rounds, %llu ns/switch\n", (unsigned)BENCH_PINGPONG_ROUNDS,
+           (unsigned long long)(elapsed / (2ULL * BENCH_PINGPONG_ROUNDS)));
+}
+
+static void bench_periodic(void)
+{
+    task_handle_t tasks[BENCH_PERIODIC_TASKS];
+
+    g_order_hash = 2166136261UL;
+
+    for (uint32_t i = 0; i < BENCH_PERIODIC_TASKS; i++) {
+        tasks[i] = sched_task_create(task_periodic, "Periodic", 512, (void *)(uintptr_t)i,
+                                     BENCH_WORKER_PRIORITY - 1);
+    }
+
+    sched_delay(BENCH_PERIODIC_TICKS);
+
+    /* 控制任务优先级最高，运行期间周期任务不会修改统计 */
+    for (uint32_t i = 0; i < BENCH_PERIODIC_TASKS; i++) {
+        sched_task_delete(tasks[i]);
+    }
+
+    printf("period, wakeups, mean lateness, max lateness (ticks)\n");
+    for (uint32_t i = 0; i < BENCH_PERIODIC_TASKS; i++) {
+        const bench_periodic_t *st = &g_periodic[i];
+        uint32_t mean_x100 = st->wakeups ? (uint32_t)(st->sum_lateness * 100U / st->wakeups) : 0;
+        printf("%u, %u, %u.%02u, %u\n", (unsigned)g_periods[i], (unsigned)st->wakeups,
+               mean_x100 / 100U, mean_x100 % 100U, (unsigned)st->max_lateness);
+    }
+    printf("wake order digest, 0x%08x\n", (unsigned)g_order_hash);
+}
+
+/**
+ * 控制任务：依次运行各项测量后退出进程
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    printf("\n[sched_bench_posix] %s time, tick %u Hz\n",
+           SCHED_POSIX_VIRTUAL_TIME ? "virtual" : "real", (unsigned)SCHED_TICK_RATE_HZ);
+
+    bench_pingpong();
+    bench_periodic();
+
+    printf("[sched_bench_posix] done\n");
+    exit(0);
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+
+    sched_init();
+
+    g_ctrl = sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_idle, "Idle", 256, NULL, 0);
+
+    sched_start();
+
+    while (1);
+}
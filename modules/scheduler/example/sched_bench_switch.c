@@ -0,0 +1,117 @@
+/**
+ * @file    sched_bench_switch.c
+ * @brief   就绪队列基准测试：上下文切换开销 vs 同优先级任务数
+ *
+ * 测试方法：
+ * 1. 控制任务 (最高优先级) 依次创建 N = 1 ~ SCHED_MAX_TASKS-1 个同优先级工作任务
+ * 2. 工作任务循环调用 sched_yield()，用 DWT CYCCNT 记录 "yield -> 下一任务恢复" 的周期数
+ * 3. 每轮运行 BENCH_ROUND_TICKS 后统计 min/mean/max，经 RTT 输出
+ *
+ * 期望结果：切换开销与 N 无关 (O(1) 就绪队列)。
+ */
+
+#include "scheduler.h"
+#include "board.h"
+#include "bench_common.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_WORKER_PRIORITY   1
+#define BENCH_CTRL_PRIORITY     (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_ROUND_TICKS       200    /* 每轮测量时长 (ms) */
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+static volatile uint32_t g_yield_stamp;   /* 最近一次 yield 前的 CYCCNT */
+static volatile bool     g_stamp_valid;   /* 时间戳有效 (排除跨轮次/被 tick 打断的样本) */
+static bench_stat_t      g_stat;
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+/**
+ * 工作任务：测量 yield 到下一个同优先级任务恢复的周期数
+ */
+static void task_worker(void *param)
+{
+    (void)param;
+
+    while (1) {
+        uint32_t now = DWT->CYCCNT;
+
+        if (g_stamp_valid) {
+            bench_stat_add(&g_stat, now - g_yield_stamp);
+        }
+
+        g_stamp_valid = true;
+        g_yield_stamp = DWT->CYCCNT;
+        sched_yield();
+    }
+}
+
+/**
+ * 控制任务：逐轮增加工作任务数量并输出结果
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    static task_handle_t workers[SCHED_MAX_TASKS];
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_switch] tasks, min, mean, max (cycles)\n");
+
+    for (uint32_t n = 1; n < SCHED_MAX_TASKS; n++) {
+        for (uint32_t i = 0; i < n; i++) {
+            workers[i] = sched_task_create(task_worker, "Worker", 256, NULL,
+                                           BENCH_WORKER_PRIORITY);
+        }
+
+        sched_enter_critical();
+        bench_stat_reset(&g_stat);
+        g_stamp_valid = false;
+        sched_exit_critical();
+
+        sched_delay(BENCH_ROUND_TICKS);
+
+        /* 冻结统计：控制任务运行期间工作任务不会执行 */
+        bench_stat_t result = g_stat;
+
+        for (uint32_t i = 0; i < n; i++) {
+            sched_task_delete(workers[i]);
+        }
+
+        uint32_t mean = result.count ? (uint32_t)(result.sum / result.count) : 0;
+        SEGGER_RTT_printf(0, "%2u, %u, %u, %u\n",
+                          (unsigned)n, (unsigned)result.min, (unsigned)mean, (unsigned)result.max);
+    }
+
+    SEGGER_RTT_printf(0, "[sched_bench_switch] done\n");
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    dwt_cyccnt_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
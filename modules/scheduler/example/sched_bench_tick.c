@@ -0,0 +1,152 @@
+/**
+ * @file    sched_bench_tick.c
+ * @brief   SysTick 处理开销基准测试：延时任务数 4 / 16 / 64
+ *
+ * 测试方法 (周期窃取法，无需在中断内插桩)：
+ * 1. 创建 N 个长时间 sched_delay() 的休眠任务，此时每个 tick 都 "无任务到期"
+ * 2. 最低优先级的测量任务连续读取 DWT CYCCNT，两次读取间隔超过
+ *    BENCH_GAP_THRESHOLD 即视为被 SysTick 打断，间隔即为中断耗时
+ * 3. 统计 min/mean/max，经 RTT 输出
+ *
+ * 注意：测量任务独占 CPU 时仍会每个时间片触发一次 PendSV，
+ * 该样本会计入 max；min/mean 反映 "无任务到期" 的 tick 开销。
+ *
+ * 64 任务需要以 -DSCHED_MAX_TASKS=66 (休眠任务 + 控制任务 + 测量任务) 配置构建，
+ * 并同时指定 -DSCHED_STACK_ARENA_SIZE=18432：默认栈区为 66 x 1 KB，超出 F407
+ * 64 KB CCMRAM 中的 .task_stacks；本测试只需 64 x 256 + 1024 + 256 字节。
+ */
+
+#include "scheduler.h"
+#include "board.h"
+#include "bench_common.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_CTRL_PRIORITY     (SCHED_MAX_PRIORITIES - 1)
+#define BENCH_SLEEPER_PRIORITY  1
+#define BENCH_PROBE_PRIORITY    0
+#define BENCH_ROUND_TICKS       1000     /* 每轮测量时长 (ms) */
+#define BENCH_SLEEP_TICKS       60000    /* 休眠任务延时, 远大于测量时长 */
+#define BENCH_GAP_THRESHOLD     30       /* 判定为中断的最小间隔 (周期) */
+
+static const uint32_t bench_task_counts[] = {4, 16, 64};
+
+/* ========================================================================
+ * 测量数据
+ * ======================================================================== */
+
+static bench_stat_t      g_stat;
+static volatile bool     g_probe_enable;
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+static void task_sleeper(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_delay(BENCH_SLEEP_TICKS);
+    }
+}
+
+/**
+ * 测量任务：记录被中断 "偷走" 的周期数
+ */
+static void task_probe(void *param)
+{
+    (void)param;
+
+    uint32_t last = DWT->CYCCNT;
+
+    while (1) {
+        uint32_t now = DWT->CYCCNT;
+        uint32_t gap = now - last;
+
+        if (g_probe_enable && gap > BENCH_GAP_THRESHOLD) {
+            bench_stat_add(&g_stat, gap);
+        }
+
+        last = now;
+    }
+}
+
+/**
+ * 控制任务：逐轮创建休眠任务并输出结果
+ */
+static void task_bench_ctrl(void *param)
+{
+    (void)param;
+
+    static task_handle_t sleepers[SCHED_MAX_TASKS];
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_tick] sleepers, samples, min, mean, max (cycles)\n");
+
+    for (uint32_t r = 0; r < sizeof(bench_task_counts) / sizeof(bench_task_counts[0]); r++) {
+        uint32_t n = bench_task_counts[r];
+        uint32_t created = 0;
+
+        for (uint32_t i = 0; i < n; i++) {
+            sleepers[i] = sched_task_create(task_sleeper, "Sleeper", 256, NULL,
+                                            BENCH_SLEEPER_PRIORITY);
+            if (sleepers[i] == NULL) break;
+            created++;
+        }
+
+        if (created < n) {
+            SEGGER_RTT_printf(0, "%2u, skipped (only %u tasks created, raise SCHED_MAX_TASKS)\n",
+                              (unsigned)n, (unsigned)created);
+        } else {
+            /* 先让休眠任务全部进入延时链表 */
+            sched_delay(10);
+
+            sched_enter_critical();
+            bench_stat_reset(&g_stat);
+            g_probe_enable = true;
+            sched_exit_critical();
+
+            sched_delay(BENCH_ROUND_TICKS);
+
+            g_probe_enable = false;
+            bench_stat_t result = g_stat;
+
+            uint32_t mean = result.count ? (uint32_t)(result.sum / result.count) : 0;
+            SEGGER_RTT_printf(0, "%2u, %u, %u, %u, %u\n",
+                              (unsigned)n, (unsigned)result.count,
+                              (unsigned)result.min, (unsigned)mean, (unsigned)result.max);
+        }
+
+        for (uint32_t i = 0; i < created; i++) {
+            sched_task_delete(sleepers[i]);
+        }
+    }
+
+    SEGGER_RTT_printf(0, "[sched_bench_tick] done\n");
+
+    while (1) {
+        sched_delay(1000);
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    dwt_cyccnt_init();
+
+    sched_init();
+
+    sched_task_create(task_bench_ctrl, "BenchCtrl", 1024, NULL, BENCH_CTRL_PRIORITY);
+    sched_task_create(task_probe, "Probe", 256, NULL, BENCH_PROBE_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file    sched_bench_tickless.c
+ * @brief   无滴答空闲测试：统计空闲期间每秒的唤醒 (中断) 次数
+ *
+ * 测试方法：
+ * 1. 报告任务每 BENCH_REPORT_TICKS 醒来一次，其余时间只有空闲任务就绪
+ * 2. 空闲任务每次从 sched_idle_sleep() 返回计为一次唤醒
+ * 3. 报告任务输出本周期的唤醒次数与 tick_count 增量
+ *
+ * 期望结果：
+ * - 周期滴答 (SCHED_USE_TICKLESS_IDLE=OFF)：约 1000 次/秒
+ * - 无滴答 (SCHED_USE_TICKLESS_IDLE=ON)：约 1000 / max_suppressed_ticks 次/秒
+ *   (24-bit SysTick 单次最长睡眠 400MHz 约 41ms，168MHz 约 99ms)
+ * - 两种模式下 tick 增量都应等于 BENCH_REPORT_TICKS，可配合外部示波器
+ *   观察 LED1 翻转周期核对 tick_count 补偿是否正确
+ */
+
+#include "scheduler.h"
+#include "board.h"
+#include "SEGGER_RTT.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#define BENCH_REPORT_PRIORITY   1
+#define BENCH_IDLE_PRIORITY     0
+#define BENCH_REPORT_TICKS      SCHED_TICK_RATE_HZ   /* 每秒报告一次 */
+
+static volatile uint32_t g_idle_wakeups;
+
+/* ========================================================================
+ * 任务定义
+ * ======================================================================== */
+
+static void task_report(void *param)
+{
+    (void)param;
+
+    sched_tick_t last_tick = sched_get_tick_count();
+
+    SEGGER_RTT_printf(0, "\n[sched_bench_tickless] tickless=%u, wakeups/s, ticks\n",
+                      (unsigned)SCHED_USE_TICKLESS_IDLE);
+
+    while (1) {
+        sched_delay(BENCH_REPORT_TICKS);
+
+        sched_enter_critical();
+        uint32_t wakeups = g_idle_wakeups;
+        g_idle_wakeups = 0;
+        sched_exit_critical();
+
+        sched_tick_t now = sched_get_tick_count();
+        board_led_toggle(BOARD_LED_1);
+
+        SEGGER_RTT_printf(0, "%u, %u\n", (unsigned)wakeups, (unsigned)(now - last_tick));
+        last_tick = now;
+    }
+}
+
+static void task_idle(void *param)
+{
+    (void)param;
+
+    while (1) {
+        sched_idle_sleep();
+        g_idle_wakeups++;
+    }
+}
+
+/* ========================================================================
+ * 主函数
+ * ======================================================================== */
+
+int main(void)
+{
+    board_init();
+    board_led_init();
+
+    sched_init();
+
+    sched_task_create(task_report, "Report", 512, NULL, BENCH_REPORT_PRIORITY);
+    sched_task_create(task_idle, "Idle", 256, NULL, BENCH_IDLE_PRIORITY);
+
+    sched_start();
+
+    while (1);
+}
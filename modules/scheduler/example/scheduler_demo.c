@@ -107,7 +107,7 @@ void task_idle(void *param)
          * - 看门狗喂狗
          * - 统计 CPU 使用率
          */
-        __WFI();  /* 等待中断 */
+        sched_idle_sleep();  /* 等待中断 (无滴答模式下停止周期滴答) */
     }
 }
 
@@ -0,0 +1,103 @@
+/**
+ * @file    sched_basic.h
+ * @brief   运行到完成的基本任务：同一优先级的基本任务共享一个栈
+ * @author  EmbeddedTemplate
+ *
+ * 设计要点：
+ * - 基本任务只是一个函数，每次激活从头执行到返回，中途不阻塞 (数据包处理、周期采样等)
+ * - 每个用到的优先级有一个分发任务 (首次创建该优先级的基本任务时从栈区分配)，
+ *   激活以普通函数调用的方式在分发任务的栈上执行，基本任务本身不需要 TCB 和栈
+ * - 不同优先级的分发任务之间照常抢占；同一优先级内按创建顺序依次执行，不会互相抢占
+ * - 激活来源：其他任务/中断调用 sched_basic_task_activate[_from_isr]()，或按周期自动激活
+ *
+ * 使用限制：
+ * - 基本任务内不能调用阻塞的内核 API，否则阻塞同优先级的所有基本任务
+ * - 同一优先级的栈大小取首次创建时 max(SCHED_BASIC_STACK_SIZE, stack_size)，
+ *   之后创建的基本任务要求更大的栈时创建失败
+ * - 基本任务创建后不能删除
+ */
+
+#ifndef SCHED_BASIC_H
+#define SCHED_BASIC_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 配置参数
+ * ======================================================================== */
+
+#ifndef SCHED_BASIC_STACK_SIZE
+#define SCHED_BASIC_STACK_SIZE      1024   /* 每个优先级共享栈的默认大小 (字节) */
+#endif
+#define SCHED_BASIC_MAX_PENDING     0xFFFFU /* 未执行激活数上限，超出计为丢失 */
+
+/* ========================================================================
+ * 类型定义
+ * ======================================================================== */
+
+typedef void (*sched_basic_func_t)(void *param);
+
+/**
+ * 基本任务控制块 (由调用者静态分配)
+ */
+typedef struct sched_basic_task {
+    sched_basic_func_t       func;
+    void                    *param;
+    const char              *name;
+    struct sched_basic_task *next;          /* 同优先级链表 */
+    sched_tick_t             period;        /* 自动激活周期，0 表示只由事件激活 */
+    sched_tick_t             next_release;  /* 下一次周期激活时刻 */
+    uint32_t                 activations;   /* 已执行次数 */
+    uint32_t                 lost;          /* 丢失的激活 (周期错过 / 未执行数溢出) */
+    volatile uint16_t        pending;       /* 已请求未执行的激活数 */
+    uint8_t                  priority;
+} sched_basic_task_t;
+
+/* ========================================================================
+ * 基本任务 API
+ * ======================================================================== */
+
+/**
+ * 创建基本任务
+ *
+ * @param task        基本任务控制块
+ * @param func        任务函数 (每次激活调用一次)
+ * @param name        任务名称 (调试用)
+ * @param param       任务参数
+ * @param priority    优先级 (0-SCHED_MAX_PRIORITIES-1)
+ * @param stack_size  任务函数所需栈深度 (字节)，0 表示 SCHED_BASIC_STACK_SIZE
+ * @param period      自动激活周期 (滴答)，0 表示只由 sched_basic_task_activate 激活
+ * @return            true=成功, false=参数无效/共享栈不足/分发任务创建失败
+ */
+bool sched_basic_task_create(sched_basic_task_t *task, sched_basic_func_t func, const char *name,
+                             void *param, uint8_t priority, uint32_t stack_size,
+                             sched_tick_t period);
+
+/**
+ * 激活基本任务 (任务上下文)，分发任务空闲时立即调度
+ *
+ * @return true=成功, false=未执行激活数已达上限 (计入 lost)
+ */
+bool sched_basic_task_activate(sched_basic_task_t *task);
+
+/**
+ * 激活基本任务 (中断上下文)
+ *
+ * @param woken  [in/out] 同 sched_task_notify_from_isr()
+ */
+bool sched_basic_task_activate_from_isr(sched_basic_task_t *task, bool *woken);
+
+/**
+ * 获取优先级对应的共享栈大小 (字节)，该优先级没有基本任务时返回 0
+ */
+uint32_t sched_basic_get_stack_size(uint8_t priority);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_BASIC_H */
@@ -0,0 +1,249 @@
+/**
+ * @file    sched_coro.h
+ * @brief   无栈协程：在一个调度器任务中协作运行大量轻量活动
+ * @author  EmbeddedTemplate
+ *
+ * 设计要点：
+ * - 协程是一个普通函数加一个 sched_coro_t (Cortex-M 上 20 字节)，没有独立的栈和 TCB，
+ *   挂起点用 switch/case 记录行号，恢复时从上次挂起处继续执行 (Duff's device)
+ * - 一个执行器 (sched_coro_executor_t) 绑定一个调度器任务，按链表轮流运行就绪协程；
+ *   所有协程都挂起时执行器任务按最近到期时刻阻塞，不占用 CPU
+ * - 延时基于调度器滴答；事件可由任务或中断发出，通过任务通知唤醒执行器
+ *
+ * 使用限制：
+ * - 局部变量不跨挂起点保存，需要保持的状态放在 param 指向的结构体中
+ * - 挂起宏只能直接写在协程函数体内 (不能在被调用的子函数或 switch 语句中)
+ * - 协程内不能调用阻塞的内核 API (sched_delay / sched_sem_take 等)，否则阻塞整个执行器
+ * - 执行器任务的任务通知由执行器占用
+ *
+ * 示例：
+ *   static void blink(sched_coro_t *co, void *param)
+ *   {
+ *       SCHED_CORO_BEGIN(co);
+ *       while (1) {
+ *           board_led_toggle(BOARD_LED_1);
+ *           SCHED_CORO_DELAY(co, 500);
+ *       }
+ *       SCHED_CORO_END(co);
+ *   }
+ */
+
+#ifndef SCHED_CORO_H
+#define SCHED_CORO_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 类型定义
+ * ======================================================================== */
+
+typedef struct sched_coro sched_coro_t;
+typedef struct sched_coro_executor sched_coro_executor_t;
+
+/**
+ * 协程函数 (每次恢复都从头调用，由 SCHED_CORO_BEGIN 跳到挂起点)
+ */
+typedef void (*sched_coro_func_t)(sched_coro_t *co, void *param);
+
+/**
+ * 协程状态
+ */
+typedef enum {
+    SCHED_CORO_READY = 0,   /* 可运行 (新启动 / 主动让出) */
+    SCHED_CORO_DELAYED,     /* 等待 wake_time 到期 */
+    SCHED_CORO_WAITING,     /* 等待条件成立 (事件到达) */
+    SCHED_CORO_DONE         /* 已结束，执行器将其移出 */
+} sched_coro_state_t;
+
+/**
+ * 协程控制块 (由调用者静态分配)
+ */
+struct sched_coro {
+    sched_coro_func_t  func;
+    void              *param;
+    sched_coro_t      *next;          /* 执行器链表 */
+    sched_tick_t       wake_time;     /* DELAYED: 唤醒时刻 */
+    uint16_t           resume_point;  /* 挂起点行号，0 表示从头开始 */
+    uint8_t            state;         /* sched_coro_state_t */
+};
+
+/**
+ * 协程执行器 (一个执行器在一个调度器任务中运行)
+ */
+struct sched_coro_executor {
+    sched_coro_t      *head;          /* 运行中的协程 */
+    sched_coro_t      *pending;       /* 新启动、尚未并入 head 的协程 */
+    task_handle_t      task;          /* 运行执行器的任务 */
+    uint32_t           count;         /* 运行中的协程数 */
+};
+
+/**
+ * 协程事件 (计数语义：每次发出唤醒一个等待者，未被等待时累计)
+ */
+typedef struct {
+    volatile uint32_t       count;
+    sched_coro_executor_t  *executor;  /* 等待者所在的执行器 */
+} sched_coro_event_t;
+
+/* ========================================================================
+ * 协程体宏
+ * ======================================================================== */
+
+/**
+ * 协程体开始 / 结束 (成对出现，包住整个函数体)
+ */
+#define SCHED_CORO_BEGIN(co)    switch ((co)->resume_point) { case 0:
+#define SCHED_CORO_END(co)      } (co)->state = SCHED_CORO_DONE; return
+
+/* 顺序执行进入 case 标签 (宏内不能用注释标注，预处理会删除注释) */
+#if defined(__has_attribute)
+#if __has_attribute(fallthrough)
+#define SCHED_CORO_FALLTHROUGH_ __attribute__((fallthrough))
+#endif
+#endif
+#ifndef SCHED_CORO_FALLTHROUGH_
+#define SCHED_CORO_FALLTHROUGH_ ((void)0)
+#endif
+
+/* 记录挂起点并返回执行器，恢复时从 case 标签继续 */
+#define SCHED_CORO_SUSPEND_(co, st)                             \
+    do {                                                        \
+        (co)->state = (st);                                     \
+        (co)->resume_point = (uint16_t)__LINE__;                \
+        return;                                                 \
+        case __LINE__:;                                         \
+    } while (0)
+
+/**
+ * 让出执行器，本轮其他协程运行后继续
+ */
+#define SCHED_CORO_YIELD(co)    SCHED_CORO_SUSPEND_(co, SCHED_CORO_READY)
+
+/**
+ * 延时 ticks 个滴答 (0 等同于 SCHED_CORO_YIELD)
+ */
+#define SCHED_CORO_DELAY(co, ticks)                             \
+    do {                                                        \
+        (co)->wake_time = sched_get_tick_count() + (ticks);     \
+        SCHED_CORO_SUSPEND_(co, SCHED_CORO_DELAYED);            \
+    } while (0)
+
+/**
+ * 延时到 *prev + increment，并更新 *prev (周期执行不累积漂移，语义同 sched_delay_until)
+ *
+ * prev 必须指向跨挂起点保存的变量 (不能是局部变量)
+ */
+#define SCHED_CORO_DELAY_UNTIL(co, prev, increment)             \
+    do {                                                        \
+        *(prev) += (increment);                                 \
+        (co)->wake_time = *(prev);                              \
+        SCHED_CORO_SUSPEND_(co, SCHED_CORO_DELAYED);            \
+    } while (0)
+
+/**
+ * 挂起直到条件成立
+ *
+ * 条件在执行器每次被唤醒时重新求值 (有协程延时到期或任意事件发出)；
+ * 由其他任务/中断改变的条件应配合 sched_coro_event_signal() 唤醒执行器
+ */
+#define SCHED_CORO_WAIT_UNTIL(co, cond)                         \
+    do {                                                        \
+        (co)->resume_point = (uint16_t)__LINE__;                \
+        SCHED_CORO_FALLTHROUGH_;                                \
+        case __LINE__:                                          \
+        if (!(cond)) {                                          \
+            (co)->state = SCHED_CORO_WAITING;                   \
+            return;                                             \
+        }                                                       \
+        (co)->state = SCHED_CORO_READY;                         \
+    } while (0)
+
+/**
+ * 等待事件 (取走一次计数)
+ */
+#define SCHED_CORO_WAIT_EVENT(co, ev)                           \
+    SCHED_CORO_WAIT_UNTIL(co, sched_coro_event_take(ev))
+
+/**
+ * 结束协程 (可出现在协程体任意位置)
+ */
+#define SCHED_CORO_EXIT(co)                                     \
+    do {                                                        \
+        (co)->state = SCHED_CORO_DONE;                          \
+        return;                                                 \
+    } while (0)
+
+/* ========================================================================
+ * 执行器 API
+ * ======================================================================== */
+
+/**
+ * 初始化执行器
+ */
+void sched_coro_executor_init(sched_coro_executor_t *executor);
+
+/**
+ * 启动协程 (可在任务中、协程中或 sched_coro_run 之前调用，不可在中断中调用)
+ *
+ * @param co      协程控制块 (结束前不能复用)
+ * @param func    协程函数
+ * @param param   协程状态，每次恢复原样传入
+ */
+void sched_coro_start(sched_coro_executor_t *executor, sched_coro_t *co,
+                      sched_coro_func_t func, void *param);
+
+/**
+ * 运行执行器 (在执行器任务函数中调用，永不返回)
+ */
+void sched_coro_run(sched_coro_executor_t *executor);
+
+/**
+ * 运行一轮就绪协程 (供自行组织循环的任务使用)
+ *
+ * @return 距离最近一个协程到期的滴答数：0 表示有协程让出需立即再运行，
+ *         SCHED_WAIT_FOREVER 表示所有协程都在等待事件
+ */
+sched_tick_t sched_coro_poll(sched_coro_executor_t *executor);
+
+/**
+ * 运行中的协程数 (包括等待中的协程)
+ */
+uint32_t sched_coro_count(const sched_coro_executor_t *executor);
+
+/* ========================================================================
+ * 事件 API
+ * ======================================================================== */
+
+/**
+ * 初始化事件，等待者须运行在 executor 中
+ */
+void sched_coro_event_init(sched_coro_event_t *event, sched_coro_executor_t *executor);
+
+/**
+ * 发出事件 (任务或协程上下文)
+ */
+void sched_coro_event_signal(sched_coro_event_t *event);
+
+/**
+ * 发出事件 (中断上下文)
+ *
+ * @param woken  [in/out] 同 sched_task_notify_from_isr()
+ */
+void sched_coro_event_signal_from_isr(sched_coro_event_t *event, bool *woken);
+
+/**
+ * 取走一次事件计数 (SCHED_CORO_WAIT_EVENT 使用)
+ *
+ * @return true=取到, false=计数为 0
+ */
+bool sched_coro_event_take(sched_coro_event_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_CORO_H */
@@ -0,0 +1,97 @@
+/**
+ * @file    sched_queue.h
+ * @brief   调度器消息队列：固定大小槽位的环形队列，支持中断发送与阻塞接收
+ * @author  EmbeddedTemplate
+ *
+ * 设计要点：
+ * - 存储区由调用者提供 (静态分配)，队列本身不做动态内存分配
+ * - 槽位大小任意：传递指针 (item_size = sizeof(void *)) 即为零拷贝，
+ *   小结构体可直接按值传递
+ * - 接收方阻塞在队列的等待链表上，消息到达时立即进入就绪队列，
+ *   延迟由一次上下文切换决定，而不是轮询周期
+ * - 中断中只能使用 sched_queue_send_from_isr() (不阻塞)，队列满时丢弃并计数；
+ *   唤醒标志在中断退出前交给 sched_yield_from_isr()，一次中断最多切换一次
+ *
+ * @note 入队/出队的拷贝在临界区内进行，大于几个字的数据请传递指针
+ *       (尤其是 sched_queue_send_from_isr，拷贝时间计入中断屏蔽时间)
+ */
+
+#ifndef SCHED_QUEUE_H
+#define SCHED_QUEUE_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 类型定义
+ * ======================================================================== */
+
+typedef struct {
+    uint8_t           *buffer;          /* 槽位存储区 (capacity * item_size 字节) */
+    uint16_t           item_size;       /* 槽位大小 (字节) */
+    uint16_t           capacity;        /* 槽位数量 */
+    uint16_t           head;            /* 读位置 */
+    uint16_t           tail;            /* 写位置 */
+    uint16_t           count;           /* 当前消息数 */
+    uint32_t           overflow_count;  /* 中断发送时队列满被丢弃的消息数 */
+    sched_wait_list_t  recv_waiters;    /* 等待接收的任务 */
+    sched_wait_list_t  send_waiters;    /* 等待发送的任务 */
+} sched_queue_t;
+
+/* ========================================================================
+ * 消息队列 API
+ * ======================================================================== */
+
+/**
+ * 初始化消息队列
+ *
+ * @param queue      队列
+ * @param buffer     槽位存储区，至少 capacity * item_size 字节
+ * @param item_size  每条消息大小 (字节)
+ * @param capacity   槽位数量
+ */
+void sched_queue_init(sched_queue_t *queue, void *buffer, uint16_t item_size, uint16_t capacity);
+
+/**
+ * 发送消息 (任务上下文)
+ *
+ * @param queue    队列
+ * @param item     消息指针，拷贝 item_size 字节
+ * @param timeout  队列满时的等待滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return         true=成功, false=超时
+ */
+bool sched_queue_send(sched_queue_t *queue, const void *item, sched_tick_t timeout);
+
+/**
+ * 发送消息 (中断上下文，不阻塞)
+ *
+ * 有任务等待接收时将其唤醒，优先级高于被中断任务时置位 *woken。
+ *
+ * @param woken  [in/out] 需要切换时置 true，NULL 表示立即挂起 PendSV
+ * @return       true=成功, false=队列满 (overflow_count 加 1)
+ */
+bool sched_queue_send_from_isr(sched_queue_t *queue, const void *item, bool *woken);
+
+/**
+ * 接收消息 (任务上下文)
+ *
+ * @param queue    队列
+ * @param item     接收缓冲区，至少 item_size 字节
+ * @param timeout  队列空时的等待滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return         true=成功, false=超时
+ */
+bool sched_queue_receive(sched_queue_t *queue, void *item, sched_tick_t timeout);
+
+/**
+ * 获取队列中的消息数
+ */
+uint16_t sched_queue_count(const sched_queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_QUEUE_H */
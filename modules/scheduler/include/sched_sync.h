@@ -0,0 +1,127 @@
+/**
+ * @file    sched_sync.h
+ * @brief   调度器同步原语：优先级继承互斥锁、计数信号量
+ * @author  EmbeddedTemplate
+ *
+ * 设计要点：
+ * - 等待任务进入 TASK_BLOCKED 并挂到对象的等待链表，不轮询、不关中断等待
+ * - 超时复用 block_time / 延时链表，由 SysTick 唤醒
+ * - 释放时直接把资源移交给优先级最高的等待者，避免被低优先级任务抢走
+ * - 互斥锁支持优先级继承，防止优先级反转：持有者本身在等待另一把锁时，
+ *   继承的优先级沿 "等待的锁 -> 持有者" 链逐级传递；等待超时或解锁后，
+ *   持有者回落到基础优先级与仍持有各锁最高等待者中的较高者
+ *
+ * 使用限制：
+ * - 互斥锁只能在任务中使用，不可在中断中调用
+ * - 中断中释放信号量使用 sched_sem_give_from_isr()，sched_sem_take() 只能在任务中调用
+ * - 调用内核的中断优先级数值不能小于 SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY
+ */
+
+#ifndef SCHED_SYNC_H
+#define SCHED_SYNC_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 类型定义
+ * ======================================================================== */
+
+/**
+ * 互斥锁 (不可递归)
+ */
+typedef struct sched_mutex {
+    tcb_t              *owner;      /* 持有者，NULL 表示空闲 */
+    sched_wait_list_t   waiters;    /* 等待任务 (优先级降序) */
+    struct sched_mutex *held_next;  /* 持有者的已持有锁链表 */
+} sched_mutex_t;
+
+/**
+ * 计数信号量
+ */
+typedef struct {
+    uint32_t           count;      /* 当前计数 */
+    uint32_t           max_count;  /* 最大计数 */
+    sched_wait_list_t  waiters;    /* 等待任务 (优先级降序) */
+} sched_sem_t;
+
+/* ========================================================================
+ * 互斥锁 API
+ * ======================================================================== */
+
+/**
+ * 初始化互斥锁
+ */
+void sched_mutex_init(sched_mutex_t *mutex);
+
+/**
+ * 获取互斥锁
+ *
+ * 锁被占用时阻塞等待；持有者优先级低于调用者时临时提升到调用者优先级。
+ *
+ * @param mutex    互斥锁
+ * @param timeout  超时滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return         true=获取成功, false=超时或重复加锁
+ */
+bool sched_mutex_lock(sched_mutex_t *mutex, sched_tick_t timeout);
+
+/**
+ * 释放互斥锁
+ *
+ * 持有者释放所有互斥锁后恢复基础优先级；有等待者时直接移交所有权。
+ *
+ * @return true=成功, false=调用者不是持有者
+ */
+bool sched_mutex_unlock(sched_mutex_t *mutex);
+
+/* ========================================================================
+ * 计数信号量 API
+ * ======================================================================== */
+
+/**
+ * 初始化计数信号量
+ *
+ * @param sem        信号量
+ * @param initial    初始计数
+ * @param max_count  最大计数 (二值信号量为 1)
+ */
+void sched_sem_init(sched_sem_t *sem, uint32_t initial, uint32_t max_count);
+
+/**
+ * 获取信号量 (计数减 1)
+ *
+ * @param sem      信号量
+ * @param timeout  超时滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return         true=获取成功, false=超时
+ */
+bool sched_sem_take(sched_sem_t *sem, sched_tick_t timeout);
+
+/**
+ * 释放信号量 (计数加 1，有等待者时直接唤醒)
+ *
+ * @return true=成功, false=计数已达上限
+ */
+bool sched_sem_give(sched_sem_t *sem);
+
+/**
+ * 释放信号量 (中断上下文)
+ *
+ * @param woken  [in/out] 唤醒了比被中断任务优先级更高的任务时置 true，
+ *               由中断退出前的 sched_yield_from_isr() 统一切换；NULL 表示立即挂起 PendSV
+ * @return       true=成功, false=计数已达上限
+ */
+bool sched_sem_give_from_isr(sched_sem_t *sem, bool *woken);
+
+/**
+ * 获取信号量当前计数
+ */
+uint32_t sched_sem_get_count(const sched_sem_t *sem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_SYNC_H */
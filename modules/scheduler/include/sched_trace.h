@@ -0,0 +1,113 @@
+/**
+ * @file    sched_trace.h
+ * @brief   内核事件跟踪 (二进制记录经 SEGGER RTT 上行通道输出)
+ *
+ * 开启方式：-DSCHED_TRACE=ON (CMake 选项)，关闭时以下 API 展开为空操作。
+ *
+ * 记录格式 (小端)：
+ *   uint32_t timestamp;   运行时间计数器 (ARM: DWT CYCCNT; POSIX: 1 MHz)
+ *   uint8_t  type;        sched_trace_event_t
+ *   uint8_t  id;          任务编号 (任务事件) / 中断编号 (中断事件)
+ *   uint16_t arg;         事件参数
+ * 名称记录 (TASK_CREATE / ISR_NAME) 后跟 name_len 字节名称，补齐到 4 字节。
+ *
+ * 开销：每个事件一次计数器读取 + 8 字节写入环形缓冲区，与缓冲区状态无关；
+ * 缓冲区满时丢弃事件并计数，下一次写入成功前先补一条 OVERFLOW 记录。
+ *
+ * 主机端：J-Link RTT Logger 读取 SCHED_TRACE_RTT_CHANNEL 保存为二进制文件，
+ * 用 tools/sched_trace.py 转换为 Chrome Trace / Perfetto JSON。
+ */
+
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 配置参数
+ * ======================================================================== */
+
+#ifndef SCHED_TRACE_RTT_CHANNEL
+#define SCHED_TRACE_RTT_CHANNEL     1      /* RTT 上行通道 (0 为终端输出) */
+#endif
+#ifndef SCHED_TRACE_BUFFER_SIZE
+#define SCHED_TRACE_BUFFER_SIZE     4096   /* 上行缓冲区大小 (字节) */
+#endif
+#define SCHED_TRACE_MAX_NAME_LEN    24     /* 名称记录最多携带的字节数 (4 的倍数) */
+#define SCHED_TRACE_VERSION         1      /* 记录格式版本 (START 记录的 arg) */
+
+/* ========================================================================
+ * 记录定义 (与 tools/sched_trace.py 保持一致)
+ * ======================================================================== */
+
+typedef enum {
+    SCHED_TRACE_START = 0,         /* timestamp = 计数器频率 (Hz), arg = 格式版本 */
+    SCHED_TRACE_TASK_CREATE,       /* arg = 优先级 | (name_len << 8)，后跟名称 */
+    SCHED_TRACE_TASK_DELETE,
+    SCHED_TRACE_SWITCH_IN,         /* 任务开始运行 */
+    SCHED_TRACE_TICK,              /* arg = 滴答计数低 16 位 */
+    SCHED_TRACE_DELAY,             /* arg = 延时滴答数 (饱和到 0xFFFF) */
+    SCHED_TRACE_BLOCK,             /* arg = sched_trace_block_reason_t */
+    SCHED_TRACE_READY,             /* 阻塞任务被唤醒 (事件到达或超时) */
+    SCHED_TRACE_ISR_ENTER,         /* id = 中断编号 */
+    SCHED_TRACE_ISR_EXIT,
+    SCHED_TRACE_ISR_NAME,          /* arg = name_len，后跟名称 */
+    SCHED_TRACE_OVERFLOW           /* arg = 此前丢弃的事件数 (饱和到 0xFFFF) */
+} sched_trace_event_t;
+
+typedef enum {
+    SCHED_TRACE_BLOCK_NOTIFY = 0,  /* 等待任务通知 */
+    SCHED_TRACE_BLOCK_SYNC         /* 等待信号量/互斥锁/队列 */
+} sched_trace_block_reason_t;
+
+typedef struct {
+    uint32_t timestamp;
+    uint8_t  type;
+    uint8_t  id;
+    uint16_t arg;
+} sched_trace_record_t;
+
+/* ========================================================================
+ * 跟踪 API
+ * ======================================================================== */
+
+#if SCHED_TRACE
+/**
+ * 记录中断进入 (在中断处理函数开头调用)
+ *
+ * 只能用于优先级允许调用内核的中断 (数值 >= SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY)
+ *
+ * @param irq 应用自定义的中断编号 (0-255)
+ */
+void sched_trace_isr_enter(uint8_t irq);
+
+/**
+ * 记录中断退出 (在 sched_yield_from_isr() 之后、中断返回前调用)
+ */
+void sched_trace_isr_exit(uint8_t irq);
+
+/**
+ * 为中断编号命名 (主机端显示为独立轨道)，可在任意时刻调用
+ */
+void sched_trace_isr_name(uint8_t irq, const char *name);
+
+/**
+ * 获取累计丢弃的事件数
+ */
+uint32_t sched_trace_get_dropped(void);
+#else
+#define sched_trace_isr_enter(irq)         ((void)(irq))
+#define sched_trace_isr_exit(irq)          ((void)(irq))
+#define sched_trace_isr_name(irq, name)    ((void)(irq), (void)(name))
+#define sched_trace_get_dropped()          (0UL)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_TRACE_H */
@@ -6,6 +6,7 @@
  * 核心特性：
  * - 抢占式优先级调度
  * - 时间片轮转 (相同优先级)
+ * - 周期任务 (绝对时刻释放、截止期错失统计、可选 EDF)
  * - 最小栈开销
  * - Cortex-M 优化
  */
@@ -25,13 +26,100 @@ extern "C" {
  * 配置参数
  * ======================================================================== */
 
-#define SCHED_MAX_PRIORITIES        8      /* 支持的最大优先级数 (0-7, 7最高) */
+#ifndef SCHED_MAX_PRIORITIES
+#define SCHED_MAX_PRIORITIES        8      /* 支持的最大优先级数 (0-7, 7最高), 最大 32 */
+#endif
+#ifndef SCHED_MAX_TASKS
 #define SCHED_MAX_TASKS             16     /* 最大任务数 */
+#endif
 #define SCHED_TICK_RATE_HZ          1000   /* 系统滴答频率 (1ms) */
 #define SCHED_TIME_SLICE_TICKS      10     /* 时间片长度 (10ms) */
 #define SCHED_MIN_STACK_SIZE        256    /* 最小栈大小 (字节) */
 #define SCHED_DEFAULT_STACK_SIZE    1024   /* 默认栈大小 (字节) */
 
+/* 任务栈区总大小 (字节)，位于 .task_stacks 段，按任务 stack_size 切分 */
+#ifndef SCHED_STACK_ARENA_SIZE
+#define SCHED_STACK_ARENA_SIZE      (SCHED_MAX_TASKS * SCHED_DEFAULT_STACK_SIZE)
+#endif
+
+/* 无滴答空闲: 仅空闲任务就绪时停止周期性 SysTick，直到下一个延时任务到期 */
+#ifndef SCHED_USE_TICKLESS_IDLE
+#define SCHED_USE_TICKLESS_IDLE     0
+#endif
+#define SCHED_TICKLESS_MIN_IDLE_TICKS 2    /* 预计空闲少于该值时不进入无滴答模式 */
+
+/* MPU 栈保护：切换时把入栈任务栈底的 32 字节设为禁止访问区，溢出立即触发 MemManage
+ * (仅 ARM_CM4F 移植层，占用最高编号 MPU 区域；每个栈底最多损失 63 字节) */
+#ifndef SCHED_MPU_STACK_GUARD
+#define SCHED_MPU_STACK_GUARD       0
+#endif
+#define SCHED_MPU_GUARD_SIZE        32     /* 保护区大小 (MPU 最小区域) */
+/* 保护区起始地址：栈底向上对齐到保护区大小 (MPU 区域基址须按大小对齐) */
+#define SCHED_MPU_GUARD_BASE(stack_base) \
+    (((uintptr_t)(stack_base) + SCHED_MPU_GUARD_SIZE - 1U) & ~(uintptr_t)(SCHED_MPU_GUARD_SIZE - 1U))
+
+/* 栈溢出检测：切换时检查出栈任务的 SP 与栈底保护字 (开销为几次比较，可常开)
+ * 开启 MPU 栈保护时默认关闭 (保护字位于禁止访问区内，且硬件检测已覆盖) */
+#ifndef SCHED_STACK_OVERFLOW_CHECK
+#define SCHED_STACK_OVERFLOW_CHECK  (!SCHED_MPU_STACK_GUARD)
+#endif
+#if SCHED_STACK_OVERFLOW_CHECK && SCHED_MPU_STACK_GUARD
+#error "SCHED_STACK_OVERFLOW_CHECK 与 SCHED_MPU_STACK_GUARD 不能同时开启"
+#endif
+#define SCHED_STACK_GUARD_WORDS     4      /* 栈底保护字数量 (16 字节) */
+#define SCHED_STACK_PAINT_PATTERN   0xA5A5A5A5UL
+
+/* 栈水位线：创建任务时填充整个栈，用于统计历史最小剩余栈空间 */
+#ifndef SCHED_STACK_WATERMARK
+#define SCHED_STACK_WATERMARK       0
+#endif
+
+/* NVIC 优先级位数 (STM32F4/H7 均为 4) */
+#ifndef SCHED_NVIC_PRIO_BITS
+#define SCHED_NVIC_PRIO_BITS        4
+#endif
+
+/*
+ * 可调用内核 API 的最高中断优先级 (NVIC 抢占优先级数值，越小越高)
+ *
+ * 临界区通过 BASEPRI 只屏蔽数值 >= 该值的中断；数值更小 (优先级更高) 的中断
+ * 在临界区内保持响应，但绝不能调用任何 sched_* API。
+ * 设为 0 时退回 PRIMASK 方式，临界区屏蔽全部可屏蔽中断。
+ */
+#ifndef SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY
+#define SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY  5
+#endif
+
+#define SCHED_MAX_SYSCALL_BASEPRI \
+    ((uint32_t)SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - SCHED_NVIC_PRIO_BITS))
+
+#if (SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY < 0) || \
+    (SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY >= (1 << SCHED_NVIC_PRIO_BITS))
+#error "SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY 超出 NVIC 优先级范围"
+#endif
+
+/* 运行时间统计：每次切换把 CPU 周期计数 (DWT CYCCNT) 增量累加到出栈任务 */
+#ifndef SCHED_RUNTIME_STATS
+#define SCHED_RUNTIME_STATS         0
+#endif
+
+/* 内核事件跟踪：切换/阻塞/唤醒/滴答/中断等事件以二进制记录写入 RTT 通道 (sched_trace.h) */
+#ifndef SCHED_TRACE
+#define SCHED_TRACE                 0
+#endif
+
+/* 运行时间统计与事件跟踪共用移植层的自由运行周期计数器 */
+#define SCHED_USE_RUN_TIME_COUNTER  (SCHED_RUNTIME_STATS || SCHED_TRACE)
+
+/* 最早截止期优先：同一优先级内的周期任务按绝对截止期调度 (不同优先级之间仍按优先级抢占) */
+#ifndef SCHED_USE_EDF
+#define SCHED_USE_EDF               0
+#endif
+
+#if (SCHED_MAX_PRIORITIES < 1) || (SCHED_MAX_PRIORITIES > 32)
+#error "SCHED_MAX_PRIORITIES 必须在 1-32 之间 (就绪位图为 32-bit)"
+#endif
+
 /* ========================================================================
  * 类型定义
  * ======================================================================== */
@@ -49,6 +137,28 @@ typedef enum {
 
 typedef void (*task_function_t)(void *param);
 
+/**
+ * 任务通知动作
+ */
+typedef enum {
+    SCHED_NOTIFY_SET_BITS = 0,   /* 通知值 |= value (事件标志) */
+    SCHED_NOTIFY_INCREMENT,      /* 通知值 += 1, 忽略 value (轻量计数信号量) */
+    SCHED_NOTIFY_OVERWRITE       /* 通知值 = value (邮箱) */
+} sched_notify_action_t;
+
+#define SCHED_WAIT_FOREVER          ((sched_tick_t)0xFFFFFFFFUL)  /* 永久等待 */
+
+struct task_control_block;
+struct sched_mutex;
+
+/**
+ * 等待链表 (信号量/互斥锁等同步对象内嵌)
+ * 按任务优先级降序排列，同优先级先到先得
+ */
+typedef struct sched_wait_list {
+    struct task_control_block *head;
+} sched_wait_list_t;
+
 /**
  * 任务控制块 (TCB)
  * 参考 FreeRTOS 设计，但更简化
@@ -56,20 +166,52 @@ typedef void (*task_function_t)(void *param);
 typedef struct task_control_block {
     sched_stack_t      *stack_ptr;         /* 当前栈指针 */
     sched_stack_t      *stack_base;        /* 栈底 */
-    uint32_t            stack_size;        /* 栈大小 */
+    uint32_t            stack_size;        /* 栈大小 (字节, 8 字节对齐) */
 
     task_function_t     task_func;         /* 任务函数 */
     void               *param;             /* 任务参数 */
 
-    uint8_t             priority;          /* 优先级 (0-7) */
+    uint8_t             priority;          /* 优先级 (0 ~ SCHED_MAX_PRIORITIES-1) */
+    uint8_t             base_priority;     /* 基础优先级 (优先级继承前) */
+    bool                static_alloc;      /* TCB 与栈由调用者提供 (删除时不归还任务池/栈区) */
+    bool                wait_signaled;     /* 等待结果: true=被事件唤醒, false=超时 */
+    uint8_t             notify_state;      /* 通知状态: 无 / 等待中 / 已挂起 */
     task_state_t        state;             /* 任务状态 */
 
     sched_tick_t        time_slice;        /* 剩余时间片 */
     sched_tick_t        block_time;        /* 阻塞超时时间 */
+    uint32_t            notify_value;      /* 任务通知值 */
+
+    sched_tick_t        period;            /* 周期 (滴答)，0 表示非周期任务 */
+    sched_tick_t        rel_deadline;      /* 相对截止期 (滴答, <= period) */
+    sched_tick_t        release_time;      /* 当前作业释放时刻 */
+    sched_tick_t        abs_deadline;      /* 当前作业绝对截止期 */
+    uint32_t            deadline_misses;   /* 截止期错失次数 (含被跳过的作业) */
 
     const char         *name;              /* 任务名称 (调试用) */
 
-    struct task_control_block *next;       /* 链表指针 */
+    struct task_control_block *next;       /* 链表后继 (就绪队列 / 空闲链表) */
+    struct task_control_block *prev;       /* 链表前驱 (就绪队列) */
+
+    struct task_control_block *delay_next; /* 延时链表后继 (按 block_time 升序) */
+    struct task_control_block *delay_prev; /* 延时链表前驱 */
+
+    sched_wait_list_t         *wait_list;  /* 正在等待的同步对象 (NULL 表示未等待) */
+    struct task_control_block *wait_next;  /* 等待链表后继 */
+    struct task_control_block *wait_prev;  /* 等待链表前驱 */
+
+    struct sched_mutex        *wait_mutex;   /* 正在等待的互斥锁 (继承优先级沿持有链传递) */
+    struct sched_mutex        *held_mutexes; /* 持有的互斥锁链表 (计算继承优先级) */
+
+#if SCHED_RUNTIME_STATS
+    uint64_t            run_time;          /* 累计运行周期 */
+    uint32_t            switch_count;      /* 被切入次数 */
+    struct task_control_block *static_next; /* 静态任务链表 (统计时遍历) */
+#endif
+
+#if SCHED_TRACE
+    uint8_t             trace_id;          /* 跟踪记录中的任务编号 (1-255 循环分配) */
+#endif
 } tcb_t;
 
 /**
@@ -77,6 +219,91 @@ typedef struct task_control_block {
  */
 typedef tcb_t* task_handle_t;
 
+/**
+ * 静态任务描述符 (SCHED_TASK_DEFINE 放入 sched_task_table 段，sched_start 时创建)
+ */
+typedef struct {
+    task_function_t task_func;     /* 任务函数 */
+    const char     *name;          /* 任务名称 */
+    void           *param;         /* 任务参数 */
+    sched_stack_t  *stack;         /* 栈存储 (8 字节对齐) */
+    uint32_t        stack_size;    /* 栈大小 (字节) */
+    tcb_t          *tcb;           /* TCB 存储 */
+    uint8_t         priority;      /* 优先级 */
+} sched_task_desc_t;
+
+/**
+ * 定义静态任务栈 (8 字节对齐，与任务栈区同在 .task_stacks 段)
+ */
+#define SCHED_STATIC_STACK(var, size) \
+    static sched_stack_t var[((size) + 7U) / 8U * 2U] \
+        __attribute__((section(".task_stacks"), aligned(8)))
+
+/**
+ * 在链接期任务表中定义一个任务，sched_start() 时自动创建，不占用任务池与栈区
+ *
+ * 示例 (文件作用域)：
+ *   SCHED_TASK_DEFINE(led, task_led, NULL, 1, 512);
+ *   其他文件用 SCHED_TASK_DECLARE(led) 声明后，通过 SCHED_TASK_HANDLE(led) 取得句柄
+ *
+ * @param id         任务标识 (同时用作任务名称)
+ * @param func       任务函数
+ * @param arg        任务参数
+ * @param prio       优先级
+ * @param size       栈大小 (字节)
+ */
+#define SCHED_TASK_DEFINE(id, func, arg, prio, size)                           \
+    SCHED_STATIC_STACK(sched_stack_##id, size);                                \
+    tcb_t sched_tcb_##id;                                                      \
+    static const sched_task_desc_t sched_task_desc_##id                        \
+        __attribute__((used, section("sched_task_table"), aligned(4))) = {     \
+        .task_func  = (func),                                                  \
+        .name       = #id,                                                     \
+        .param      = (arg),                                                   \
+        .stack      = sched_stack_##id,                                        \
+        .stack_size = sizeof(sched_stack_##id),                                \
+        .tcb        = &sched_tcb_##id,                                         \
+        .priority   = (prio)                                                   \
+    }
+
+#define SCHED_TASK_DECLARE(id)  extern tcb_t sched_tcb_##id
+#define SCHED_TASK_HANDLE(id)   (&sched_tcb_##id)
+
+/**
+ * 任务栈区使用情况
+ */
+typedef struct {
+    uint32_t total_size;           /* 栈区总大小 */
+    uint32_t used_size;            /* 已分配字节数 */
+    uint32_t free_size;            /* 空闲字节数 */
+    uint32_t largest_free_block;   /* 最大连续空闲块 (可创建的最大栈) */
+    uint16_t used_blocks;          /* 已分配块数 */
+    uint16_t free_blocks;          /* 空闲块数 */
+    uint8_t  fragmentation_pct;    /* 碎片率 (%) = 100 - 最大空闲块 * 100 / 空闲总量 */
+} sched_stack_arena_info_t;
+
+#if SCHED_RUNTIME_STATS
+/**
+ * 单个任务的运行时间快照
+ */
+typedef struct {
+    const char   *name;            /* 任务名称 */
+    uint8_t       priority;        /* 当前优先级 */
+    task_state_t  state;           /* 任务状态 */
+    uint64_t      run_time;        /* 累计运行周期 (含其运行期间发生的中断) */
+    uint32_t      switch_count;    /* 被切入次数 */
+} sched_task_runtime_t;
+
+/**
+ * 整体运行时间快照 (自 sched_start 起累计，两次快照相减即为区间值)
+ */
+typedef struct {
+    uint64_t      elapsed;         /* 经过的周期 (按滴答数折算，包含睡眠时间) */
+    uint64_t      busy;            /* 非空闲任务运行周期之和 */
+    uint16_t      cpu_load_pct10;  /* CPU 负载 (0.1%) = busy * 1000 / elapsed */
+} sched_runtime_summary_t;
+#endif
+
 /* ========================================================================
  * 调度器 API
  * ======================================================================== */
@@ -88,6 +315,8 @@ void sched_init(void);
 
 /**
  * 启动调度器 (永不返回)
+ *
+ * 先创建链接期任务表 (SCHED_TASK_DEFINE) 中的全部任务，再切换到第一个任务
  */
 void sched_start(void);
 
@@ -96,9 +325,10 @@ void sched_start(void);
  *
  * @param task_func  任务函数
  * @param name       任务名称
- * @param stack_size 栈大小 (字节)
+ * @param stack_size 栈大小 (字节)，按 8 字节对齐从栈区分配；
+ *                   0 表示 SCHED_DEFAULT_STACK_SIZE，小于 SCHED_MIN_STACK_SIZE 时取最小值
  * @param param      任务参数
- * @param priority   优先级 (0-7, 7最高)
+ * @param priority   优先级 (0 ~ SCHED_MAX_PRIORITIES-1, 数值越大优先级越高)
  * @return           任务句柄, NULL表示失败
  */
 task_handle_t sched_task_create(
@@ -110,10 +340,78 @@ task_handle_t sched_task_create(
 );
 
 /**
- * 删除任务
+ * 使用调用者提供的 TCB 与栈创建任务 (不占用任务池与栈区，不会因池耗尽失败)
+ *
+ * @param stack      栈存储，8 字节对齐 (可用 SCHED_STATIC_STACK 定义)
+ * @param stack_size 栈大小 (字节)，不小于 SCHED_MIN_STACK_SIZE，按 8 字节向下取整
+ * @param tcb        TCB 存储，任务删除 (且已切换离开) 后才可复用
+ * @return           任务句柄 (即 tcb)，参数无效时返回 NULL
+ * @note             其余参数同 sched_task_create()
+ */
+task_handle_t sched_task_create_static(
+    task_function_t task_func,
+    const char     *name,
+    sched_stack_t  *stack,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority,
+    tcb_t          *tcb
+);
+
+/**
+ * 创建周期任务
+ *
+ * 第一个作业在创建时刻释放，之后每 period 个滴答释放一次；任务函数每完成一个
+ * 作业调用 sched_task_wait_next_period()。启用 SCHED_USE_EDF 时，同优先级的
+ * 周期任务按绝对截止期调度，并排在同优先级非周期任务之前。
+ *
+ * @param period     周期 (滴答, > 0)
+ * @param deadline   相对截止期 (滴答)，0 表示等于周期，不能大于周期
+ * @return           任务句柄, NULL表示失败
+ * @note             其余参数同 sched_task_create()
+ */
+task_handle_t sched_task_create_periodic(
+    task_function_t task_func,
+    const char     *name,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority,
+    sched_tick_t    period,
+    sched_tick_t    deadline
+);
+
+/**
+ * 删除任务 (栈空间归还栈区并与相邻空闲块合并)
  */
 void sched_task_delete(task_handle_t task);
 
+/**
+ * 获取任务栈区使用情况 (含碎片率)
+ */
+void sched_get_stack_arena_info(sched_stack_arena_info_t *info);
+
+#if SCHED_STACK_WATERMARK
+/**
+ * 获取任务栈高水位线 (历史最小剩余栈空间)
+ *
+ * @param task 任务句柄，NULL 表示当前任务
+ * @return     从未被使用过的栈字节数，越小越接近溢出
+ */
+uint32_t sched_task_get_stack_high_water(task_handle_t task);
+#endif
+
+#if SCHED_STACK_OVERFLOW_CHECK || SCHED_MPU_STACK_GUARD
+/**
+ * 栈溢出钩子 (弱定义，应用可重写以记录/复位)
+ *
+ * 软件检测时在 PendSV 中检测到出栈任务溢出时调用；MPU 栈保护时在 MemManage
+ * 异常中调用 (task 为触发保护区访问的当前任务)。默认关中断死循环
+ *
+ * @param task 溢出的任务
+ */
+void sched_stack_overflow_hook(task_handle_t task);
+#endif
+
 /**
  * 任务主动让出 CPU (触发上下文切换)
  */
@@ -126,6 +424,122 @@ void sched_yield(void);
  */
 void sched_delay(sched_tick_t ticks);
 
+/**
+ * 延时到绝对时刻 (周期循环不随循环体耗时漂移)
+ *
+ * 唤醒时刻 = *prev_wake_time + increment，并写回 *prev_wake_time；
+ * 首次调用前把 *prev_wake_time 初始化为 sched_get_tick_count()。
+ *
+ * @param prev_wake_time [in/out] 上一次唤醒时刻
+ * @param increment      周期 (滴答)
+ * @return               true=已延时, false=唤醒时刻已过 (循环体超时)，立即返回
+ */
+bool sched_delay_until(sched_tick_t *prev_wake_time, sched_tick_t increment);
+
+/**
+ * 结束当前周期作业，阻塞到下一个释放时刻 (仅周期任务)
+ *
+ * 完成时刻晚于绝对截止期时计一次错失并调用 sched_deadline_miss_hook()；
+ * 落后超过一个周期时跳过已错过的释放点 (每个计一次错失)，保持原有相位而不连续补跑。
+ *
+ * @return true=本作业按时完成, false=错失截止期或调用者不是周期任务
+ */
+bool sched_task_wait_next_period(void);
+
+/**
+ * 获取任务截止期错失次数
+ *
+ * @param task 任务句柄，NULL 表示当前任务
+ */
+uint32_t sched_task_get_deadline_misses(task_handle_t task);
+
+/**
+ * 截止期错失钩子 (弱定义，默认空实现)
+ *
+ * 在错失任务自身上下文中调用 (不在临界区内)，可用于上报 CPU 负载接近饱和；
+ * 不应阻塞，否则会推迟下一个作业。
+ *
+ * @param task 错失截止期的任务
+ */
+void sched_deadline_miss_hook(task_handle_t task);
+
+#if SCHED_RUNTIME_STATS
+/**
+ * 获取运行时间快照
+ *
+ * 调用 sched_idle_sleep() 的任务视为空闲任务；空闲时间 = 经过时间 - 忙碌时间，
+ * 因此 WFI 睡眠期间 (CYCCNT 停止计数) 也能正确计入空闲。
+ *
+ * @param tasks      [out] 任务快照数组，可为 NULL
+ * @param max_tasks  数组容量
+ * @param summary    [out] 整体快照，可为 NULL
+ * @return           写入 tasks 的任务数
+ */
+uint32_t sched_get_runtime_stats(sched_task_runtime_t *tasks, uint32_t max_tasks,
+                                 sched_runtime_summary_t *summary);
+#endif
+
+/* ========================================================================
+ * 任务通知 API (最轻量的唤醒方式: 每任务 5 字节, 无额外对象)
+ * ======================================================================== */
+
+/**
+ * 向任务发送通知 (任务上下文)
+ *
+ * @param task    目标任务
+ * @param value   通知值 (SCHED_NOTIFY_INCREMENT 时忽略)
+ * @param action  更新通知值的方式
+ */
+void sched_task_notify(task_handle_t task, uint32_t value, sched_notify_action_t action);
+
+/**
+ * 向任务发送通知 (中断上下文)
+ *
+ * @param woken  [in/out] 唤醒了比被中断任务优先级更高的任务时置 true (只置位不清零)，
+ *               由中断退出前的 sched_yield_from_isr() 统一切换；
+ *               为 NULL 时立即挂起 PendSV
+ */
+void sched_task_notify_from_isr(task_handle_t task, uint32_t value,
+                                sched_notify_action_t action, bool *woken);
+
+/**
+ * 等待通知 (事件标志 / 邮箱用法)
+ *
+ * @param clear_on_entry  等待前清除的位 (仅在没有挂起通知时清除)
+ * @param clear_on_exit   收到通知后清除的位
+ * @param value           [out] 收到通知时的通知值 (清除前)，可为 NULL
+ * @param timeout         超时滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return                true=收到通知, false=超时
+ */
+bool sched_task_notify_wait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+                            uint32_t *value, sched_tick_t timeout);
+
+/**
+ * 获取通知计数 (计数信号量用法，配合 SCHED_NOTIFY_INCREMENT)
+ *
+ * @param clear_on_exit  true=返回前清零 (二值), false=减 1 (计数)
+ * @param timeout        超时滴答数，0 表示不等待，SCHED_WAIT_FOREVER 表示永久等待
+ * @return               取走前的通知值，0 表示超时
+ */
+uint32_t sched_task_notify_take(bool clear_on_exit, sched_tick_t timeout);
+
+/**
+ * 空闲等待 (由空闲任务循环调用)
+ *
+ * 普通模式下执行 WFI；启用 SCHED_USE_TICKLESS_IDLE 且调用者是唯一就绪任务时，
+ * 由移植层停止周期滴答并睡眠到下一个延时任务到期，唤醒后补齐 tick_count。
+ */
+void sched_idle_sleep(void);
+
+/**
+ * 中断退出前请求上下文切换
+ *
+ * 一次中断内多次调用 *_from_isr() 后只调用一次，无论唤醒多少任务只挂起一次 PendSV。
+ *
+ * @param woken  *_from_isr() 汇总的唤醒标志，false 时不做任何事
+ */
+void sched_yield_from_isr(bool woken);
+
 /**
  * 获取系统滴答计数
  */
@@ -137,12 +551,14 @@ sched_tick_t sched_get_tick_count(void);
 task_handle_t sched_get_current_task(void);
 
 /**
- * 进入临界区 (禁止中断)
+ * 进入临界区 (屏蔽优先级数值 >= SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY 的中断)
+ *
+ * 可在任务和允许调用内核的中断中使用，支持嵌套。
  */
 void sched_enter_critical(void);
 
 /**
- * 退出临界区 (使能中断)
+ * 退出临界区 (最外层退出时解除屏蔽)
  */
 void sched_exit_critical(void);
 
@@ -184,6 +600,27 @@ void port_yield(void);
  */
 void port_setup_systick(uint32_t tick_rate_hz);
 
+#if SCHED_USE_RUN_TIME_COUNTER
+/**
+ * 读取自由运行的 CPU 周期计数器 (32-bit，允许回绕)
+ */
+uint32_t port_get_run_time_counter(void);
+
+/**
+ * 周期计数器频率 (Hz)
+ */
+uint32_t port_get_run_time_counter_hz(void);
+#endif
+
+#if SCHED_USE_TICKLESS_IDLE
+/**
+ * 停止周期滴答并进入低功耗，最长睡眠 expected_idle_ticks 个滴答
+ *
+ * 唤醒后调用 sched_step_tick() 补偿睡眠期间错过的滴答
+ */
+void port_suppress_ticks_and_sleep(sched_tick_t expected_idle_ticks);
+#endif
+
 /* ========================================================================
  * 中断处理函数 (在 port.c 中定义为 naked 函数)
  * ======================================================================== */
@@ -4,6 +4,7 @@
  */
 
 #include "scheduler.h"
+#include "board.h"
 
 /* ========================================================================
  * Cortex-M4 寄存器定义
@@ -21,10 +22,66 @@
 #define NVIC_SYSTICK_CLK_BIT      (1UL << 2UL)
 #define NVIC_SYSTICK_INT_BIT      (1UL << 1UL)
 #define NVIC_SYSTICK_ENABLE_BIT   (1UL << 0UL)
+#define NVIC_SYSTICK_COUNT_FLAG   (1UL << 16UL)
+#define SYSTICK_MAX_RELOAD        (0x00FFFFFFUL)    /* 24-bit 计数器 */
+
+#define DEMCR_REG                 (*((volatile uint32_t*)0xE000EDFC))
+#define DEMCR_TRCENA_BIT          (1UL << 24UL)
+#define DWT_LAR_REG               (*((volatile uint32_t*)0xE0001FB0))
+#define DWT_LAR_UNLOCK            (0xC5ACCE55UL)    /* Cortex-M7 需要解锁 */
+#define DWT_CTRL_REG              (*((volatile uint32_t*)0xE0001000))
+#define DWT_CTRL_CYCCNTENA_BIT    (1UL << 0UL)
+#define DWT_CYCCNT_REG            (*((volatile uint32_t*)0xE0001004))
+
+#define FPU_FPCCR_REG             (*((volatile uint32_t*)0xE000EF34))
+#define FPU_FPCCR_ASPEN_BIT       (1UL << 31UL)     /* 使用 FPU 时自动置位 CONTROL.FPCA */
+#define FPU_FPCCR_LSPEN_BIT       (1UL << 30UL)     /* 惰性压栈 S0-S15/FPSCR */
+
+#define MPU_TYPE_REG              (*((volatile uint32_t*)0xE000ED90))
+#define MPU_CTRL_REG              (*((volatile uint32_t*)0xE000ED94))
+#define MPU_RNR_REG               (*((volatile uint32_t*)0xE000ED98))
+#define MPU_RBAR_REG              (*((volatile uint32_t*)0xE000ED9C))
+#define MPU_RASR_REG              (*((volatile uint32_t*)0xE000EDA0))
+#define MPU_CTRL_ENABLE_BIT       (1UL << 0UL)
+#define MPU_CTRL_PRIVDEFENA_BIT   (1UL << 2UL)      /* 未覆盖的地址沿用默认内存映射 */
+#define MPU_RBAR_VALID_BIT        (1UL << 4UL)      /* 同时写入 RNR 中的区域号 */
+#define MPU_RASR_XN_BIT           (1UL << 28UL)
+#define MPU_RASR_ENABLE_BIT       (1UL << 0UL)
+#define MPU_RASR_SIZE_32B         (4UL << 1UL)      /* 区域大小 2^(SIZE+1) = 32 字节 */
+#define SCB_SHCSR_REG             (*((volatile uint32_t*)0xE000ED24))
+#define SCB_SHCSR_MEMFAULTENA_BIT (1UL << 16UL)
+#define SCB_CFSR_REG              (*((volatile uint32_t*)0xE000ED28))
+#define SCB_CFSR_MSTKERR_BIT      (1UL << 4UL)      /* 异常入口压栈时访问违例 */
+#define SCB_CFSR_MLSPERR_BIT      (1UL << 5UL)      /* 惰性浮点压栈时访问违例 */
+#define SCB_CFSR_MMARVALID_BIT    (1UL << 7UL)
+#define SCB_MMFAR_REG             (*((volatile uint32_t*)0xE000ED34))
 
 /* 初始值定义 */
 #define INITIAL_XPSR              (0x01000000UL)    /* Thumb 位 */
-#define INITIAL_EXC_RETURN        (0xFFFFFFFDUL)    /* 返回线程模式, 使用PSP */
+#define INITIAL_EXC_RETURN        (0xFFFFFFFDUL)    /* 返回线程模式, 使用PSP, 无 FPU 栈帧 */
+
+/* PendSV 中调用调度器期间屏蔽可调用内核的中断 (与 sched_enter_critical 一致) */
+#if SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY > 0
+#define PORT_ASM_MASK_SYSCALL_IRQS \
+        "   mov r0, %[basepri]                      \n" \
+        "   msr basepri, r0                         \n" \
+        "   dsb                                     \n" \
+        "   isb                                     \n"
+#define PORT_ASM_UNMASK_SYSCALL_IRQS \
+        "   mov r0, #0                              \n" \
+        "   msr basepri, r0                         \n"
+#else
+#define PORT_ASM_MASK_SYSCALL_IRQS \
+        "   cpsid i                                 \n" \
+        "   dsb                                     \n" \
+        "   isb                                     \n"
+#define PORT_ASM_UNMASK_SYSCALL_IRQS \
+        "   cpsie i                                 \n"
+#endif
+
+#if !defined(__ARM_FP)
+#error "ARM_CM4F 移植层需要启用 FPU (-mfpu=fpv4-sp-d16 / fpv5-d16 -mfloat-abi=hard)"
+#endif
 
 /* ========================================================================
  * 外部引用
@@ -33,6 +90,26 @@
 extern void sched_switch_context(void);
 extern void sched_tick_handler(void);
 extern sched_stack_t** sched_get_current_stack_ptr(void);
+#if SCHED_USE_TICKLESS_IDLE
+extern sched_tick_t sched_get_expected_idle_ticks(void);
+extern void sched_step_tick(sched_tick_t ticks);
+#endif
+
+/* ========================================================================
+ * 无滴答空闲状态
+ * ======================================================================== */
+
+#if SCHED_MPU_STACK_GUARD
+static uint32_t mpu_guard_region = 0;      /* 栈保护使用的 MPU 区域号 (最高编号，优先级最高) */
+#endif
+
+#if SCHED_USE_TICKLESS_IDLE
+static uint32_t cycles_per_tick = 0;       /* 每个滴答的 SysTick 计数 */
+static uint32_t max_suppressed_ticks = 0;  /* 24-bit 计数器一次可跨越的最大滴答数 */
+
+/* 停止/重启 SysTick 期间丢失的计数补偿 (经验值) */
+#define SYSTICK_STOPPED_COMPENSATION  45UL
+#endif
 
 /* ========================================================================
  * 栈初始化
@@ -52,6 +129,7 @@ extern sched_stack_t** sched_get_current_stack_ptr(void);
  *   R0 (参数)
  *
  * 软件保存的寄存器:
+ *   [S31 ~ S16]  (仅当 EXC_RETURN bit4 = 0，即任务使用过 FPU)
  *   R11
  *   R10
  *   R9
@@ -62,6 +140,9 @@ extern sched_stack_t** sched_get_current_stack_ptr(void);
  *   R4
  *   EXC_RETURN
  *
+ * 新任务的 EXC_RETURN bit4 = 1 (基本栈帧)，第一次执行浮点指令后
+ * 硬件置位 CONTROL.FPCA，之后的异常才使用扩展栈帧。
+ *
  * FIX: LR 设置为 task_exit_error，防止任务函数返回时跳到 0x00
  */
 sched_stack_t* port_init_stack(
@@ -101,45 +182,137 @@ sched_stack_t* port_init_stack(
  * 启动第一个任务
  * ======================================================================== */
 
+/**
+ * 使能 FPU 自动状态保存与惰性压栈
+ *
+ * 任务执行浮点指令后 CONTROL.FPCA 置位，异常入口为 S0-S15/FPSCR 预留空间，
+ * 但只有异常处理中真正使用 FPU 时才实际写入，不用 FPU 的 ISR 没有额外开销。
+ */
+__attribute__((used)) static void port_enable_lazy_fpu_stacking(void)
+{
+    FPU_FPCCR_REG |= FPU_FPCCR_ASPEN_BIT | FPU_FPCCR_LSPEN_BIT;
+}
+
+#if SCHED_MPU_STACK_GUARD
+/* ========================================================================
+ * MPU 栈保护
+ * ======================================================================== */
+
+/**
+ * 把保护区域移到当前任务栈底 (PendSV 中切换后、恢复新任务上下文前调用)
+ *
+ * 只重写一个区域的 RBAR/RASR，开销为几次寄存器写
+ */
+__attribute__((used)) static void port_mpu_switch_guard(void)
+{
+    uint32_t guard = (uint32_t)SCHED_MPU_GUARD_BASE(sched_get_current_task()->stack_base);
+
+    MPU_RBAR_REG = guard | MPU_RBAR_VALID_BIT | mpu_guard_region;
+    MPU_RASR_REG = MPU_RASR_XN_BIT | MPU_RASR_SIZE_32B | MPU_RASR_ENABLE_BIT;  /* AP=0 禁止访问 */
+    __asm volatile ("dsb" ::: "memory");
+    __asm volatile ("isb");
+}
+
+/**
+ * 使能 MPU 与 MemManage 异常，为第一个任务设置保护区
+ *
+ * 板级代码已配置的区域保持不变，未覆盖的地址沿用默认内存映射
+ */
+__attribute__((used)) static void port_mpu_init(void)
+{
+    uint32_t regions = (MPU_TYPE_REG >> 8) & 0xFFUL;
+
+    if (regions == 0) {
+        /* 芯片没有 MPU：配置错误，停机便于调试 */
+        __asm volatile ("cpsid i");
+        for (;;) {
+        }
+    }
+
+    mpu_guard_region = regions - 1UL;
+    MPU_RNR_REG = mpu_guard_region;
+
+    SCB_SHCSR_REG |= SCB_SHCSR_MEMFAULTENA_BIT;
+    MPU_CTRL_REG = MPU_CTRL_ENABLE_BIT | MPU_CTRL_PRIVDEFENA_BIT;
+
+    port_mpu_switch_guard();
+}
+
+/**
+ * MemManage 异常：访问当前任务保护区 (或压栈越界) 时报告溢出任务
+ *
+ * 其它 MPU 违例 (板级区域配置等) 停机，保留 CFSR/MMFAR 供调试器查看
+ */
+void MemManage_Handler(void)
+{
+    uint32_t cfsr = SCB_CFSR_REG;
+    task_handle_t task = sched_get_current_task();
+    uint32_t guard = (uint32_t)SCHED_MPU_GUARD_BASE(task->stack_base);
+    bool overflow = (cfsr & (SCB_CFSR_MSTKERR_BIT | SCB_CFSR_MLSPERR_BIT)) != 0;
+
+    if ((cfsr & SCB_CFSR_MMARVALID_BIT) &&
+        SCB_MMFAR_REG - guard < SCHED_MPU_GUARD_SIZE) {
+        overflow = true;
+    }
+
+    if (overflow) {
+        sched_stack_overflow_hook(task);
+    }
+
+    __asm volatile ("cpsid i");
+    for (;;) {
+    }
+}
+#endif
+
 /**
  * 启动第一个任务 (naked 函数)
  *
  * 步骤：
- * 1. 设置 PSP 为第一个任务的栈指针
- * 2. 使能中断
- * 3. 触发 SVC 中断启动任务
+ * 1. 使能 FPU 惰性压栈 (开启 SCHED_MPU_STACK_GUARD 时同时使能 MPU 栈保护)
+ * 2. 设置 PSP 为第一个任务的硬件栈帧，切换到 PSP 并清除 CONTROL.FPCA
+ *    (main 中的浮点上下文不带入任务)
+ * 3. 在线程模式下手动弹出初始栈帧，使能中断后跳转到任务入口
  */
 __attribute__((naked)) void port_start_first_task(void)
 {
     __asm volatile (
+        "   bl  port_enable_lazy_fpu_stacking       \n"
+#if SCHED_MPU_STACK_GUARD
+        "   bl  port_mpu_init                       \n"
+#endif
+
         /* 获取当前任务栈指针 */
-        "   ldr r0, =sched_get_current_stack_ptr   \n"
         "   bl  sched_get_current_stack_ptr         \n"
         "   ldr r1, [r0]                            \n"  /* r1 = *current_stack_ptr */
         "   ldr r0, [r1]                            \n"  /* r0 = **current_stack_ptr */
 
-        /* 恢复软件保存的寄存器 */
-        "   ldmia r0!, {r4-r11, r14}                \n"  /* 弹出 R4-R11, EXC_RETURN */
+        /* 跳过软件保存部分 (R4-R11, EXC_RETURN)，初始值均无需恢复 */
+        "   add r0, r0, #36                         \n"
 
-        /* 设置 PSP */
+        /* 设置 PSP 指向硬件栈帧 */
         "   msr psp, r0                             \n"
         "   isb                                     \n"
 
-        /* 切换到 PSP */
-        "   mrs r0, control                         \n"
-        "   orr r0, r0, #2                          \n"  /* 使用 PSP */
+        /* 切换到 PSP，同时清除 FPCA */
+        "   movs r0, #2                             \n"
         "   msr control, r0                         \n"
         "   isb                                     \n"
 
+        /* 弹出初始栈帧: R0(参数) R1 R2 R3 R12 LR PC xPSR */
+        "   pop {r0-r5}                             \n"  /* r4 = R12, r5 = LR */
+        "   mov lr, r5                              \n"
+        "   pop {r3}                                \n"  /* r3 = PC (任务入口) */
+        "   pop {r2}                                \n"  /* xPSR 丢弃 */
+
         /* 使能中断 */
         "   cpsie i                                 \n"
         "   cpsie f                                 \n"
         "   dsb                                     \n"
         "   isb                                     \n"
 
-        /* 弹出硬件保存的寄存器, 开始执行任务 */
-        "   bx r14                                  \n"
-        "   .ltorg                                  \n"
+        /* 开始执行任务 */
+        "   bx r3                                   \n"
     );
 }
 
@@ -165,9 +338,12 @@ void port_yield(void)
  * PendSV 中断处理 (naked 函数)
  *
  * 步骤：
- * 1. 保存当前任务上下文
- * 2. 调用调度器选择下一个任务
- * 3. 恢复新任务上下文
+ * 1. 保存当前任务上下文 (EXC_RETURN bit4 = 0 时额外保存 S16-S31)
+ * 2. 调用调度器选择下一个任务 (开启 SCHED_MPU_STACK_GUARD 时把保护区移到新任务栈底)
+ * 3. 恢复新任务上下文 (按新任务的 EXC_RETURN 决定是否恢复 S16-S31)
+ *
+ * 不使用 FPU 的任务切换路径与无 FPU 时相同，只多一条 tst；
+ * 使用 FPU 的任务由硬件惰性保存 S0-S15，软件只保存 S16-S31。
  *
  * FIX: 保存 PSP 到临时寄存器，避免被函数调用覆盖
  */
@@ -178,6 +354,11 @@ __attribute__((naked)) void PendSV_Handler(void)
         "   mrs r0, psp                             \n"
         "   isb                                     \n"
 
+        /* 任务使用过 FPU (扩展栈帧)：保存 S16-S31，同时触发惰性压栈写入 S0-S15 */
+        "   tst r14, #0x10                          \n"
+        "   it eq                                   \n"
+        "   vstmdbeq r0!, {s16-s31}                 \n"
+
         /* 保存软件寄存器 (R4-R11, EXC_RETURN) */
         "   stmdb r0!, {r4-r11, r14}                \n"
 
@@ -189,8 +370,13 @@ __attribute__((naked)) void PendSV_Handler(void)
         "   ldr r2, [r0]                            \n"  /* r2 = current_task (TCB地址) */
         "   str r1, [r2]                            \n"  /* TCB->stack_ptr = r1 (修改后的PSP) */
 
-        /* 调用调度器 */
+        /* 调用调度器 (屏蔽可调用内核的中断，防止其修改就绪队列) */
+        PORT_ASM_MASK_SYSCALL_IRQS
         "   bl sched_switch_context                 \n"
+#if SCHED_MPU_STACK_GUARD
+        "   bl  port_mpu_switch_guard               \n"  /* 保护区移到新任务栈底 */
+#endif
+        PORT_ASM_UNMASK_SYSCALL_IRQS
 
         /* 获取新任务栈指针 */
         "   bl  sched_get_current_stack_ptr         \n"  /* r0 = &current_task->stack_ptr */
@@ -200,6 +386,11 @@ __attribute__((naked)) void PendSV_Handler(void)
         /* 恢复软件寄存器 */
         "   ldmia r0!, {r4-r11, r14}                \n"
 
+        /* 新任务使用过 FPU：恢复 S16-S31 */
+        "   tst r14, #0x10                          \n"
+        "   it eq                                   \n"
+        "   vldmiaeq r0!, {s16-s31}                 \n"
+
         /* 恢复 PSP */
         "   msr psp, r0                             \n"
         "   isb                                     \n"
@@ -207,6 +398,7 @@ __attribute__((naked)) void PendSV_Handler(void)
         /* 返回 */
         "   bx r14                                  \n"
         "   .ltorg                                  \n"
+        :: [basepri] "i" (SCHED_MAX_SYSCALL_BASEPRI)
     );
 }
 
@@ -214,10 +406,23 @@ __attribute__((naked)) void PendSV_Handler(void)
  * SysTick 中断处理
  * ======================================================================== */
 
+/**
+ * 板级时基默认为空 (板子未提供 board_tick_hook 时)
+ */
+__attribute__((weak)) void board_tick_hook(uint32_t ticks)
+{
+    (void)ticks;
+}
+
 void SysTick_Handler(void)
 {
-    /* 调用调度器滴答处理 */
+    /* 板级/HAL 时基 (HAL_Delay 与 HAL 超时依赖) */
+    board_tick_hook(1);
+
+    /* 调用调度器滴答处理 (与可调用内核的中断互斥) */
+    sched_enter_critical();
     sched_tick_handler();
+    sched_exit_critical();
 }
 
 /* ========================================================================
@@ -236,6 +441,18 @@ void port_setup_systick(uint32_t tick_rate_hz)
     uint32_t reload = (SystemCoreClock / tick_rate_hz) - 1UL;
     NVIC_SYSTICK_LOAD_REG = reload;
 
+#if SCHED_USE_RUN_TIME_COUNTER
+    /* 使能 DWT 周期计数器 (运行时间统计 / 事件跟踪时间戳) */
+    DEMCR_REG |= DEMCR_TRCENA_BIT;
+    DWT_LAR_REG = DWT_LAR_UNLOCK;
+    DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA_BIT;
+#endif
+
+#if SCHED_USE_TICKLESS_IDLE
+    cycles_per_tick = SystemCoreClock / tick_rate_hz;
+    max_suppressed_ticks = SYSTICK_MAX_RELOAD / cycles_per_tick;
+#endif
+
     /* 设置 PendSV 和 SysTick 为最低优先级 */
     NVIC_SYSPRI2_REG |= NVIC_PENDSV_PRI | NVIC_SYSTICK_PRI;
 
@@ -244,3 +461,117 @@ void port_setup_systick(uint32_t tick_rate_hz)
                              NVIC_SYSTICK_INT_BIT |
                              NVIC_SYSTICK_ENABLE_BIT);
 }
+
+
+#if SCHED_USE_RUN_TIME_COUNTER
+/* ========================================================================
+ * 运行时间计数器
+ * ======================================================================== */
+
+uint32_t port_get_run_time_counter(void)
+{
+    return DWT_CYCCNT_REG;
+}
+
+uint32_t port_get_run_time_counter_hz(void)
+{
+    extern uint32_t SystemCoreClock;
+    return SystemCoreClock;
+}
+#endif
+
+/* ========================================================================
+ * 无滴答空闲 (参考 FreeRTOS vPortSuppressTicksAndSleep)
+ * ======================================================================== */
+
+#if SCHED_USE_TICKLESS_IDLE
+/**
+ * 停止周期滴答并睡眠
+ *
+ * 步骤：
+ * 1. 停止 SysTick，将 reload 设置为剩余的整段空闲时间
+ * 2. 关中断后再次确认没有任务就绪 (防止检查后被中断唤醒任务)
+ * 3. WFI 睡眠，被 SysTick 到期或其他中断唤醒
+ * 4. 计算实际经过的滴答数，调用 sched_step_tick() 补偿并恢复周期滴答
+ */
+void port_suppress_ticks_and_sleep(sched_tick_t expected_idle_ticks)
+{
+    if (expected_idle_ticks > max_suppressed_ticks) {
+        expected_idle_ticks = max_suppressed_ticks;
+    }
+
+    /* 停止 SysTick，当前计数值是本滴答剩余部分 */
+    NVIC_SYSTICK_CTRL_REG &= ~NVIC_SYSTICK_ENABLE_BIT;
+
+    uint32_t reload = NVIC_SYSTICK_CURRENT_REG + (cycles_per_tick * (expected_idle_ticks - 1UL));
+    if (reload > SYSTICK_STOPPED_COMPENSATION) {
+        reload -= SYSTICK_STOPPED_COMPENSATION;
+    }
+
+    __asm volatile ("cpsid i" ::: "memory");
+    __asm volatile ("dsb");
+    __asm volatile ("isb");
+
+    /* 关中断期间有任务就绪 (或预计空闲变短)，放弃睡眠 */
+    if (sched_get_expected_idle_ticks() < expected_idle_ticks) {
+        /* 用剩余计数续完当前滴答，再恢复正常周期 */
+        NVIC_SYSTICK_LOAD_REG = NVIC_SYSTICK_CURRENT_REG;
+        NVIC_SYSTICK_CTRL_REG |= NVIC_SYSTICK_ENABLE_BIT;
+        NVIC_SYSTICK_LOAD_REG = cycles_per_tick - 1UL;
+
+        __asm volatile ("cpsie i" ::: "memory");
+        return;
+    }
+
+    /* 以长周期重启 SysTick */
+    NVIC_SYSTICK_LOAD_REG = reload;
+    NVIC_SYSTICK_CURRENT_REG = 0UL;
+    NVIC_SYSTICK_CTRL_REG |= NVIC_SYSTICK_ENABLE_BIT;
+
+    /* 睡眠：关中断状态下 WFI 仍会被挂起的中断唤醒 */
+    __asm volatile ("dsb" ::: "memory");
+    __asm volatile ("wfi");
+    __asm volatile ("isb");
+
+    /* 开中断让唤醒源 ISR 先执行 (若是 SysTick 到期，其处理函数计入 1 个滴答) */
+    __asm volatile ("cpsie i" ::: "memory");
+    __asm volatile ("dsb");
+    __asm volatile ("isb");
+    __asm volatile ("cpsid i" ::: "memory");
+    __asm volatile ("dsb");
+    __asm volatile ("isb");
+
+    /* 停止 SysTick (保持时钟源与中断使能位) */
+    NVIC_SYSTICK_CTRL_REG = (NVIC_SYSTICK_CLK_BIT | NVIC_SYSTICK_INT_BIT);
+
+    sched_tick_t completed_ticks;
+
+    if (NVIC_SYSTICK_CTRL_REG & NVIC_SYSTICK_COUNT_FLAG) {
+        /* SysTick 到期唤醒：其 ISR 已计 1 个滴答，这里补齐其余滴答 */
+        uint32_t calculated = (cycles_per_tick - 1UL) - (reload - NVIC_SYSTICK_CURRENT_REG);
+        if (calculated <= SYSTICK_STOPPED_COMPENSATION || calculated > cycles_per_tick) {
+            calculated = cycles_per_tick - 1UL;
+        }
+        NVIC_SYSTICK_LOAD_REG = calculated;
+
+        completed_ticks = expected_idle_ticks - 1UL;
+    } else {
+        /* 其他中断提前唤醒：按已经过的计数折算完整滴答，余数续到下一个滴答 */
+        uint32_t completed_cycles = (expected_idle_ticks * cycles_per_tick) - NVIC_SYSTICK_CURRENT_REG;
+        completed_ticks = completed_cycles / cycles_per_tick;
+
+        NVIC_SYSTICK_LOAD_REG = ((completed_ticks + 1UL) * cycles_per_tick) - completed_cycles;
+    }
+
+    /* 重启 SysTick 完成当前滴答，之后恢复正常周期 */
+    NVIC_SYSTICK_CURRENT_REG = 0UL;
+    NVIC_SYSTICK_CTRL_REG |= NVIC_SYSTICK_ENABLE_BIT;
+
+    sched_step_tick(completed_ticks);
+    board_tick_hook(completed_ticks);
+
+    NVIC_SYSTICK_LOAD_REG = cycles_per_tick - 1UL;
+
+    __asm volatile ("cpsie i" ::: "memory");
+}
+#endif
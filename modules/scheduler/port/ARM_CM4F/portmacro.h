@@ -0,0 +1,54 @@
+/**
+ * @file    portmacro.h
+ * @brief   Cortex-M4F/M7 移植层内联原语 (供 scheduler.c 使用)
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include "scheduler.h"
+#include "cmsis_compiler.h"
+
+/**
+ * 计算前导零个数 (就绪位图查找最高优先级)
+ */
+#define port_count_leading_zeros(x)   __CLZ(x)
+
+/**
+ * 屏蔽可调用内核的中断 (进入临界区)
+ */
+static inline void port_disable_interrupts(void)
+{
+#if SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY > 0
+    /* 只屏蔽可调用内核的中断，更高优先级的中断不受影响 */
+    __set_BASEPRI(SCHED_MAX_SYSCALL_BASEPRI);
+    __DSB();
+    __ISB();
+#else
+    __disable_irq();
+#endif
+}
+
+/**
+ * 解除屏蔽 (退出最外层临界区)
+ */
+static inline void port_enable_interrupts(void)
+{
+#if SCHED_MAX_SYSCALL_INTERRUPT_PRIORITY > 0
+    __set_BASEPRI(0);
+#else
+    __enable_irq();
+#endif
+}
+
+/**
+ * 等待中断 (空闲)
+ */
+#define port_wait_for_interrupt()     __WFI()
+
+/**
+ * 任务删除时释放移植层资源 (Cortex-M 无需处理)
+ */
+#define port_clean_up_task(task)      ((void)(task))
+
+#endif /* PORTMACRO_H */
@@ -0,0 +1,518 @@
+/**
+ * @file    port.c
+ * @brief   POSIX 主机移植层实现 (Linux 仿真与基准测试)
+ *
+ * 实现要点：
+ * - 每个任务对应一个主机线程，任意时刻只有当前任务的线程在运行，
+ *   其余线程阻塞在各自的信号量上；切换即 "唤醒下一个线程、自己睡眠"
+ * - 任务栈区仍由 scheduler.c 分配，栈顶只存放线程上下文指针，
+ *   任务实际运行在主机线程栈上 (栈水位线/溢出检测在主机上没有意义)
+ * - 临界区屏蔽的是模拟中断：中断挂起后由当前任务线程在内核边界处理，
+ *   PendSV 对应 "挂起切换标志，解除屏蔽且不在中断中时立即切换"
+ * - SysTick 为 0 号模拟中断：实时模式由独立线程周期挂起，
+ *   虚拟时间模式由空闲任务的 WFI 推进
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/* <sched.h> (经 pthread.h 引入) 声明的 int sched_yield(void) 与调度器 API 同名，
+ * 本文件不使用前者，包含系统头时将其改名 */
+#define sched_yield posix_sched_yield
+#include <errno.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#undef sched_yield
+
+#include "port_posix.h"
+#include "portmacro.h"
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+#ifndef PORT_POSIX_THREAD_STACK_SIZE
+#define PORT_POSIX_THREAD_STACK_SIZE  (256U * 1024U)  /* 任务主机线程栈大小 */
+#endif
+
+#define PORT_POSIX_TICK_IRQ           0               /* SysTick 模拟中断号 */
+#define PORT_POSIX_RUN_TIME_HZ        1000000UL       /* 运行时间计数器频率 (1 us) */
+#define PORT_POSIX_MAX_SUPPRESSED_TICKS  1000UL       /* 虚拟时间无滴答一次最多跳过的滴答数 */
+
+/* 栈顶存放线程上下文指针所需的栈单元数 */
+#define PORT_POSIX_CONTEXT_WORDS \
+    ((sizeof(port_thread_t *) + sizeof(sched_stack_t) - 1U) / sizeof(sched_stack_t))
+
+/* ========================================================================
+ * 外部引用
+ * ======================================================================== */
+
+extern void sched_switch_context(void);
+extern void sched_tick_handler(void);
+extern sched_stack_t** sched_get_current_stack_ptr(void);
+#if SCHED_USE_TICKLESS_IDLE
+extern sched_tick_t sched_get_expected_idle_ticks(void);
+extern void sched_step_tick(sched_tick_t ticks);
+#endif
+
+/* ========================================================================
+ * 线程上下文
+ * ======================================================================== */
+
+typedef struct {
+    pthread_t        thread;     /* 主机线程 */
+    sem_t            wake;       /* 被调度运行时由上一个任务释放 */
+    task_function_t  task_func;  /* 任务入口 */
+    void            *param;      /* 任务参数 */
+    bool             exiting;    /* 任务删除了自身，切换后线程退出 */
+} port_thread_t;
+
+static _Thread_local port_thread_t *self_thread = NULL;  /* 本线程对应的任务 (主线程为 NULL) */
+
+/* ========================================================================
+ * 模拟中断状态
+ *
+ * 以下变量只由当前运行的任务线程访问 (线程交接经由信号量，保证可见性)，
+ * 只有挂起位图可被其他主机线程并发修改。
+ * ======================================================================== */
+
+static bool interrupts_masked = false;  /* 临界区内 (相当于 BASEPRI/PRIMASK) */
+static bool in_interrupt = false;       /* 正在执行模拟中断处理函数 */
+static bool switch_pending = false;     /* 相当于 PendSV 挂起位 */
+static bool first_task_started = false;
+
+static atomic_uint      pending_irqs = 0;
+static atomic_uint      pending_ticks = 0;  /* 未处理的滴答数 (滴答不合并，主机调度延迟不丢时间) */
+static port_posix_isr_t isr_table[PORT_POSIX_MAX_INTERRUPTS];
+static int              isr_count = 1;  /* 0 号保留给 SysTick */
+
+/* 空闲等待 (实时模式的 WFI) */
+static pthread_mutex_t idle_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  idle_cond = PTHREAD_COND_INITIALIZER;
+
+/* ========================================================================
+ * 内部辅助函数
+ * ======================================================================== */
+
+static void port_posix_fatal(const char *what, int err)
+{
+    fprintf(stderr, "[port_posix] %s failed: %s\n", what, strerror(err));
+    abort();
+}
+
+/**
+ * 阻塞等待信号量 (被信号打断时继续等待，仍是线程取消点)
+ */
+static void semaphore_wait(sem_t *sem)
+{
+    while (sem_wait(sem) != 0) {
+        if (errno != EINTR) {
+            port_posix_fatal("sem_wait", errno);
+        }
+    }
+}
+
+/**
+ * 从任务栈顶取出线程上下文
+ */
+static port_thread_t* thread_from_stack(const sched_stack_t *stack_ptr)
+{
+    port_thread_t *thread;
+    memcpy(&thread, stack_ptr, sizeof(thread));
+    return thread;
+}
+
+static port_thread_t* current_thread(void)
+{
+    sched_stack_t **stack_ptr = sched_get_current_stack_ptr();
+    return stack_ptr ? thread_from_stack(*stack_ptr) : NULL;
+}
+
+/**
+ * 切换到调度器选出的下一个任务 (相当于 PendSV)
+ *
+ * 调用时不在临界区、不在中断中；返回时本任务已被重新调度。
+ */
+static void switch_to_next_task(void)
+{
+    port_thread_t *prev = self_thread;
+
+    /* 调度期间屏蔽模拟中断 (与 PendSV 中屏蔽可调用内核的中断一致) */
+    interrupts_masked = true;
+    switch_pending = false;
+
+    sched_switch_context();
+
+    port_thread_t *next = current_thread();
+
+    if (next != prev) {
+        /* 释放下一个线程后不能再访问 prev 以外的共享状态 */
+        bool exiting = prev->exiting;
+        sem_post(&next->wake);
+
+        if (exiting) {
+            /* 已删除的任务：线程上下文由清理函数释放 */
+            pthread_exit(NULL);
+        }
+
+        semaphore_wait(&prev->wake);
+    }
+
+    interrupts_masked = false;
+}
+
+/**
+ * 处理挂起的模拟中断与上下文切换
+ *
+ * 中断优先于切换，与 Cortex-M 上 PendSV 最低优先级、在所有中断之后执行一致。
+ */
+static void service_pending(void)
+{
+    while (first_task_started && !interrupts_masked && !in_interrupt) {
+        uint32_t irqs = atomic_exchange(&pending_irqs, 0U);
+
+        if (irqs) {
+            in_interrupt = true;
+            for (int irq = 0; irq < isr_count; irq++) {
+                if ((irqs & (1UL << irq)) && isr_table[irq]) {
+                    isr_table[irq]();
+                }
+            }
+            in_interrupt = false;
+            continue;
+        }
+
+        if (!switch_pending) {
+            break;
+        }
+
+        switch_to_next_task();
+    }
+}
+
+/* ========================================================================
+ * 任务线程
+ * ======================================================================== */
+
+static void thread_clean_up(void *arg)
+{
+    port_thread_t *thread = (port_thread_t *)arg;
+
+    sem_destroy(&thread->wake);
+    free(thread);
+}
+
+static void* task_thread_entry(void *arg)
+{
+    port_thread_t *thread = (port_thread_t *)arg;
+
+    self_thread = thread;
+
+    /* 被删除时 (阻塞在信号量上被取消) 或删除自身退出时释放上下文 */
+    pthread_cleanup_push(thread_clean_up, thread);
+
+    /* 等待第一次被调度，之后相当于从 PendSV 返回到任务入口 */
+    semaphore_wait(&thread->wake);
+    interrupts_masked = false;
+    service_pending();
+
+    thread->task_func(thread->param);
+
+    /* 任务函数不应返回 */
+    task_exit_error();
+
+    pthread_cleanup_pop(1);
+    return NULL;
+}
+
+/* ========================================================================
+ * 栈初始化
+ * ======================================================================== */
+
+/**
+ * 初始化任务栈
+ *
+ * 创建任务的主机线程 (阻塞等待第一次调度)，线程上下文指针存放在栈顶，
+ * 返回的栈指针指向该指针。
+ */
+sched_stack_t* port_init_stack(
+    sched_stack_t  *stack_top,
+    task_function_t task_func,
+    void           *param
+)
+{
+    port_thread_t *thread = (port_thread_t *)calloc(1, sizeof(port_thread_t));
+    if (!thread) {
+        port_posix_fatal("calloc", ENOMEM);
+    }
+
+    thread->task_func = task_func;
+    thread->param = param;
+    thread->exiting = false;
+
+    if (sem_init(&thread->wake, 0, 0) != 0) {
+        port_posix_fatal("sem_init", errno);
+    }
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, PORT_POSIX_THREAD_STACK_SIZE);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    int err = pthread_create(&thread->thread, &attr, task_thread_entry, thread);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        port_posix_fatal("pthread_create", err);
+    }
+
+    stack_top -= PORT_POSIX_CONTEXT_WORDS;
+    memcpy(stack_top, &thread, sizeof(thread));
+
+    return stack_top;
+}
+
+void port_clean_up_task(tcb_t *task)
+{
+    port_thread_t *thread = thread_from_stack(task->stack_ptr);
+
+    if (thread == self_thread) {
+        /* 删除自身：切换到下一个任务后线程退出 */
+        thread->exiting = true;
+        return;
+    }
+
+    /* 其他任务一定阻塞在自己的信号量上 (取消点)，取消后由清理函数释放 */
+    int err = pthread_cancel(thread->thread);
+    if (err != 0) {
+        port_posix_fatal("pthread_cancel", err);
+    }
+}
+
+/* ========================================================================
+ * 启动第一个任务
+ * ======================================================================== */
+
+void port_start_first_task(void)
+{
+    first_task_started = true;
+
+    sem_post(&current_thread()->wake);
+
+    /* 主线程不再参与调度 */
+    while (1) {
+        pause();
+    }
+}
+
+/* ========================================================================
+ * 临界区与上下文切换
+ * ======================================================================== */
+
+void port_disable_interrupts(void)
+{
+    interrupts_masked = true;
+}
+
+void port_enable_interrupts(void)
+{
+    interrupts_masked = false;
+    service_pending();
+}
+
+void port_yield(void)
+{
+    /* 挂起切换；临界区内或中断中调用时推迟到解除屏蔽/中断处理完成 */
+    switch_pending = true;
+    service_pending();
+}
+
+/* ========================================================================
+ * 模拟中断
+ * ======================================================================== */
+
+int port_posix_register_interrupt(port_posix_isr_t isr)
+{
+    if (!isr || isr_count >= PORT_POSIX_MAX_INTERRUPTS) {
+        return -1;
+    }
+
+    isr_table[isr_count] = isr;
+    return isr_count++;
+}
+
+void port_posix_trigger_interrupt(int irq)
+{
+    if (irq < 0 || irq >= isr_count) {
+        return;
+    }
+
+    atomic_fetch_or(&pending_irqs, 1U << irq);
+
+    /* 唤醒处于 WFI 的空闲任务 */
+    pthread_mutex_lock(&idle_lock);
+    pthread_cond_signal(&idle_cond);
+    pthread_mutex_unlock(&idle_lock);
+}
+
+/**
+ * 产生一个滴答 (滴答线程 / 虚拟时间的空闲任务)
+ */
+static void raise_tick(void)
+{
+    atomic_fetch_add(&pending_ticks, 1U);
+    port_posix_trigger_interrupt(PORT_POSIX_TICK_IRQ);
+}
+
+void port_wait_for_interrupt(void)
+{
+#if SCHED_POSIX_VIRTUAL_TIME
+    /* 虚拟时间：空闲即时间流逝，直接产生下一个滴答 */
+    raise_tick();
+#else
+    pthread_mutex_lock(&idle_lock);
+    while (atomic_load(&pending_irqs) == 0U) {
+        pthread_cond_wait(&idle_cond, &idle_lock);
+    }
+    pthread_mutex_unlock(&idle_lock);
+#endif
+
+    service_pending();
+}
+
+#if SCHED_POSIX_VIRTUAL_TIME
+void port_posix_consume_ticks(uint32_t ticks)
+{
+    /* 每个滴答立即处理，被抢占时在此阻塞，恢复后继续消耗剩余滴答 */
+    while (ticks--) {
+        raise_tick();
+        service_pending();
+    }
+}
+#endif
+
+/* ========================================================================
+ * SysTick 模拟
+ * ======================================================================== */
+
+static void port_tick_isr(void)
+{
+    /* 补齐处理延迟期间累积的滴答，每个滴答与 SysTick_Handler 一致 */
+    uint32_t ticks = atomic_exchange(&pending_ticks, 0U);
+
+    while (ticks--) {
+        sched_enter_critical();
+        sched_tick_handler();
+        sched_exit_critical();
+    }
+}
+
+#if !SCHED_POSIX_VIRTUAL_TIME
+/**
+ * 滴答线程：按绝对时间周期挂起 SysTick，不因处理延迟累积漂移
+ */
+static void* tick_thread_entry(void *arg)
+{
+    long period_ns = (long)(1000000000UL / (uint32_t)(uintptr_t)arg);
+    struct timespec next;
+
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    while (1) {
+        next.tv_nsec += period_ns;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR) {
+        }
+
+        raise_tick();
+    }
+
+    return NULL;
+}
+#endif
+
+void port_setup_systick(uint32_t tick_rate_hz)
+{
+    /* SysTick 固定为 0 号模拟中断 */
+    isr_table[PORT_POSIX_TICK_IRQ] = port_tick_isr;
+
+#if SCHED_POSIX_VIRTUAL_TIME
+    (void)tick_rate_hz;
+#else
+    pthread_t tick_thread;
+    int err = pthread_create(&tick_thread, NULL, tick_thread_entry,
+                             (void *)(uintptr_t)tick_rate_hz);
+    if (err != 0) {
+        port_posix_fatal("pthread_create", err);
+    }
+    pthread_detach(tick_thread);
+#endif
+}
+
+#if SCHED_USE_RUN_TIME_COUNTER
+/* ========================================================================
+ * 运行时间计数器
+ * ======================================================================== */
+
+uint32_t port_get_run_time_counter(void)
+{
+#if SCHED_POSIX_VIRTUAL_TIME
+    /* 虚拟时间只在空闲时流逝，计数器由滴答数折算 */
+    return sched_get_tick_count() * (PORT_POSIX_RUN_TIME_HZ / SCHED_TICK_RATE_HZ);
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000ULL);
+#endif
+}
+
+uint32_t port_get_run_time_counter_hz(void)
+{
+    return PORT_POSIX_RUN_TIME_HZ;
+}
+#endif
+
+/* ========================================================================
+ * 无滴答空闲
+ * ======================================================================== */
+
+#if SCHED_USE_TICKLESS_IDLE
+/**
+ * 停止周期滴答并睡眠
+ *
+ * 虚拟时间模式直接跳到下一个任务到期的滴答 (最后一个滴答走正常 SysTick 路径，
+ * 与 Cortex-M 上 "ISR 计 1 个滴答，sched_step_tick 补齐其余" 一致)；
+ * 实时模式的滴答线程不停止，退化为普通 WFI。
+ */
+void port_suppress_ticks_and_sleep(sched_tick_t expected_idle_ticks)
+{
+#if SCHED_POSIX_VIRTUAL_TIME
+    if (expected_idle_ticks > PORT_POSIX_MAX_SUPPRESSED_TICKS) {
+        expected_idle_ticks = PORT_POSIX_MAX_SUPPRESSED_TICKS;
+    }
+
+    sched_enter_critical();
+
+    /* 屏蔽期间有任务就绪或有外部中断挂起，放弃跳跃 */
+    if (sched_get_expected_idle_ticks() >= expected_idle_ticks &&
+        atomic_load(&pending_irqs) == 0U) {
+        sched_step_tick(expected_idle_ticks - 1UL);
+        raise_tick();
+    }
+
+    sched_exit_critical();
+#else
+    (void)expected_idle_ticks;
+    port_wait_for_interrupt();
+#endif
+}
+#endif
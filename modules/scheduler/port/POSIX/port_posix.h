@@ -0,0 +1,76 @@
+/**
+ * @file    port_posix.h
+ * @brief   POSIX 移植层：模拟中断接口 (供 boards/posix 的模拟外设使用)
+ *
+ * 主机上没有 NVIC，外设中断由移植层模拟：
+ * - 任意主机线程 (如读取 stdin 的 UART 接收线程) 调用
+ *   port_posix_trigger_interrupt() 挂起一个中断号
+ * - 当前运行的任务线程在下一个内核边界 (退出临界区 / yield / 空闲) 以
+ *   "中断上下文" 执行处理函数，与任务互斥，语义与 Cortex-M 上的 ISR 一致
+ * - 处理函数中只能调用 *_from_isr 接口，切换在所有挂起中断处理完后才发生
+ *
+ * @note 不调用任何内核接口的纯计算任务不会被模拟中断打断 (没有真正的异步抢占)
+ */
+
+#ifndef PORT_POSIX_H
+#define PORT_POSIX_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================
+ * 配置
+ * ======================================================================== */
+
+/**
+ * 虚拟时间模式
+ *
+ * 0: 实时模式，独立线程按 SCHED_TICK_RATE_HZ 产生滴答 (墙钟时间)
+ * 1: 虚拟时间模式，只有空闲任务进入 sched_idle_sleep() 时才推进滴答，
+ *    任务执行视为不耗时；运行结果与主机负载无关，可逐次复现
+ */
+#ifndef SCHED_POSIX_VIRTUAL_TIME
+#define SCHED_POSIX_VIRTUAL_TIME      0
+#endif
+
+#define PORT_POSIX_MAX_INTERRUPTS     8     /* 模拟中断号数量 (0 固定为 SysTick) */
+
+/* ========================================================================
+ * 模拟中断 API
+ * ======================================================================== */
+
+typedef void (*port_posix_isr_t)(void);
+
+/**
+ * 注册模拟中断处理函数
+ *
+ * @param isr  处理函数 (中断上下文执行)
+ * @return     中断号，失败返回 -1
+ */
+int port_posix_register_interrupt(port_posix_isr_t isr);
+
+/**
+ * 挂起模拟中断 (任意主机线程可调用，重复挂起只处理一次)
+ *
+ * @param irq  port_posix_register_interrupt() 返回的中断号
+ */
+void port_posix_trigger_interrupt(int irq);
+
+#if SCHED_POSIX_VIRTUAL_TIME
+/**
+ * 模拟当前任务连续计算 ticks 个滴答 (仅虚拟时间模式，任务上下文调用)
+ *
+ * 虚拟时间下任务执行不耗时，需要模拟计算负载的基准测试用本函数推进时间：
+ * 每个滴答照常处理并可能抢占当前任务，被抢占期间不计入
+ */
+void port_posix_consume_ticks(uint32_t ticks);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORT_POSIX_H */
@@ -0,0 +1,36 @@
+/**
+ * @file    portmacro.h
+ * @brief   POSIX 主机移植层原语 (供 scheduler.c 使用)
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include "scheduler.h"
+
+/**
+ * 计算前导零个数 (就绪位图查找最高优先级)
+ */
+#define port_count_leading_zeros(x)   ((x) ? (uint32_t)__builtin_clz(x) : 32UL)
+
+/**
+ * 屏蔽模拟中断 (进入临界区)
+ */
+void port_disable_interrupts(void);
+
+/**
+ * 解除屏蔽，处理期间挂起的模拟中断与上下文切换
+ */
+void port_enable_interrupts(void);
+
+/**
+ * 等待中断 (空闲；虚拟时间模式下直接推进一个滴答)
+ */
+void port_wait_for_interrupt(void);
+
+/**
+ * 任务删除时结束其主机线程
+ */
+void port_clean_up_task(tcb_t *task);
+
+#endif /* PORTMACRO_H */
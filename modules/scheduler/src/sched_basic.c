@@ -0,0 +1,208 @@
+/**
+ * @file    sched_basic.c
+ * @brief   基本任务分发实现 (每个优先级一个分发任务与共享栈)
+ */
+
+#include "sched_basic.h"
+
+/* ========================================================================
+ * 私有类型与变量
+ * ======================================================================== */
+
+typedef struct {
+    sched_basic_task_t *head;        /* 该优先级的基本任务 (按创建顺序) */
+    sched_basic_task_t *tail;
+    task_handle_t       task;        /* 分发任务 */
+    uint32_t            stack_size;  /* 共享栈大小 */
+} basic_dispatcher_t;
+
+static basic_dispatcher_t dispatchers[SCHED_MAX_PRIORITIES];
+
+/* ========================================================================
+ * 内部辅助函数
+ * ======================================================================== */
+
+/**
+ * 记录一次激活 (任务 / 中断 / 分发任务均可调用)
+ *
+ * @return false=未执行激活数已达上限，计入 lost
+ */
+static bool basic_add_pending(sched_basic_task_t *task)
+{
+    bool ok = true;
+
+    sched_enter_critical();
+    if (task->pending < SCHED_BASIC_MAX_PENDING) {
+        task->pending++;
+    } else {
+        task->lost++;
+        ok = false;
+    }
+    sched_exit_critical();
+
+    return ok;
+}
+
+/**
+ * 周期到期时释放一次激活，错过的周期计入 lost 后跳过 (与 sched_task_wait_next_period 一致)
+ *
+ * @return 距离下一次周期激活的滴答数
+ */
+static sched_tick_t basic_release_periodic(sched_basic_task_t *task, sched_tick_t now)
+{
+    int32_t late = (int32_t)(now - task->next_release);
+
+    if (late >= 0) {
+        uint32_t missed = (uint32_t)late / task->period;
+
+        task->next_release += (missed + 1U) * task->period;
+
+        if (missed > 0) {
+            sched_enter_critical();
+            task->lost += missed;
+            sched_exit_critical();
+        }
+
+        basic_add_pending(task);
+    }
+
+    return task->next_release - now;
+}
+
+/**
+ * 取走一次激活
+ */
+static bool basic_take_pending(sched_basic_task_t *task)
+{
+    bool taken = false;
+
+    sched_enter_critical();
+    if (task->pending > 0) {
+        task->pending--;
+        taken = true;
+    }
+    sched_exit_critical();
+
+    return taken;
+}
+
+/**
+ * 分发任务：依次执行本优先级所有已激活的基本任务，然后等待下一次激活或周期到期
+ *
+ * 每个基本任务每轮最多执行一次，排在后面的任务不会被反复激活的任务饿死
+ */
+static void basic_dispatcher_task(void *param)
+{
+    basic_dispatcher_t *dispatcher = (basic_dispatcher_t *)param;
+
+    while (1) {
+        sched_tick_t now = sched_get_tick_count();
+        sched_tick_t timeout = SCHED_WAIT_FOREVER;
+
+        for (sched_basic_task_t *task = dispatcher->head; task != NULL; task = task->next) {
+            if (task->period != 0) {
+                sched_tick_t remain = basic_release_periodic(task, now);
+                if (remain < timeout) {
+                    timeout = remain;
+                }
+            }
+
+            if (basic_take_pending(task)) {
+                task->func(task->param);
+                task->activations++;
+            }
+
+            if (task->pending > 0) {
+                timeout = 0;
+            }
+        }
+
+        if (timeout != 0) {
+            sched_task_notify_take(true, timeout);
+        }
+    }
+}
+
+/* ========================================================================
+ * 公共 API 实现
+ * ======================================================================== */
+
+bool sched_basic_task_create(sched_basic_task_t *task, sched_basic_func_t func, const char *name,
+                             void *param, uint8_t priority, uint32_t stack_size,
+                             sched_tick_t period)
+{
+    if (!task || !func || priority >= SCHED_MAX_PRIORITIES) return false;
+
+    basic_dispatcher_t *dispatcher = &dispatchers[priority];
+
+    if (stack_size < SCHED_BASIC_STACK_SIZE) {
+        stack_size = SCHED_BASIC_STACK_SIZE;
+    }
+
+    /* 首个基本任务：创建该优先级的分发任务与共享栈 */
+    if (dispatcher->task == NULL) {
+        dispatcher->task = sched_task_create(basic_dispatcher_task, "BasicDispatch", stack_size,
+                                             dispatcher, priority);
+        if (dispatcher->task == NULL) return false;
+        dispatcher->stack_size = stack_size;
+    } else if (stack_size > dispatcher->stack_size) {
+        return false;
+    }
+
+    task->func = func;
+    task->param = param;
+    task->name = name;
+    task->next = NULL;
+    task->period = period;
+    task->next_release = sched_get_tick_count() + period;
+    task->activations = 0;
+    task->lost = 0;
+    task->pending = 0;
+    task->priority = priority;
+
+    /* 追加到链表尾：分发任务只遍历不摘除，新节点在下一轮可见 */
+    sched_enter_critical();
+    if (dispatcher->tail) {
+        dispatcher->tail->next = task;
+    } else {
+        dispatcher->head = task;
+    }
+    dispatcher->tail = task;
+    sched_exit_critical();
+
+    /* 周期任务需要分发任务重新计算等待时间 */
+    if (period != 0) {
+        sched_task_notify(dispatcher->task, 0, SCHED_NOTIFY_INCREMENT);
+    }
+
+    return true;
+}
+
+bool sched_basic_task_activate(sched_basic_task_t *task)
+{
+    if (!task) return false;
+
+    bool ok = basic_add_pending(task);
+
+    sched_task_notify(dispatchers[task->priority].task, 0, SCHED_NOTIFY_INCREMENT);
+
+    return ok;
+}
+
+bool sched_basic_task_activate_from_isr(sched_basic_task_t *task, bool *woken)
+{
+    if (!task) return false;
+
+    bool ok = basic_add_pending(task);
+
+    sched_task_notify_from_isr(dispatchers[task->priority].task, 0, SCHED_NOTIFY_INCREMENT, woken);
+
+    return ok;
+}
+
+uint32_t sched_basic_get_stack_size(uint8_t priority)
+{
+    if (priority >= SCHED_MAX_PRIORITIES) return 0;
+
+    return dispatchers[priority].stack_size;
+}
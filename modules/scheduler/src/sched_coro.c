@@ -0,0 +1,201 @@
+/**
+ * @file    sched_coro.c
+ * @brief   无栈协程执行器实现
+ */
+
+#include "sched_coro.h"
+
+/* ========================================================================
+ * 内部辅助函数
+ * ======================================================================== */
+
+/**
+ * 并入其他任务新启动的协程 (只在执行器任务中调用)
+ */
+static void executor_merge_pending(sched_coro_executor_t *executor)
+{
+    sched_enter_critical();
+    sched_coro_t *pending = executor->pending;
+    executor->pending = NULL;
+    sched_exit_critical();
+
+    while (pending) {
+        sched_coro_t *co = pending;
+        pending = co->next;
+
+        co->next = executor->head;
+        executor->head = co;
+        executor->count++;
+    }
+}
+
+/**
+ * 唤醒执行器任务 (执行器尚未运行时事件计数保留到第一轮)
+ */
+static void executor_wake(sched_coro_executor_t *executor)
+{
+    task_handle_t task = executor->task;
+
+    if (task) {
+        sched_task_notify(task, 0, SCHED_NOTIFY_INCREMENT);
+    }
+}
+
+/* ========================================================================
+ * 执行器
+ * ======================================================================== */
+
+void sched_coro_executor_init(sched_coro_executor_t *executor)
+{
+    if (!executor) return;
+
+    executor->head = NULL;
+    executor->pending = NULL;
+    executor->task = NULL;
+    executor->count = 0;
+}
+
+void sched_coro_start(sched_coro_executor_t *executor, sched_coro_t *co,
+                      sched_coro_func_t func, void *param)
+{
+    if (!executor || !co || !func) return;
+
+    co->func = func;
+    co->param = param;
+    co->wake_time = 0;
+    co->resume_point = 0;
+    co->state = SCHED_CORO_READY;
+
+    sched_enter_critical();
+    co->next = executor->pending;
+    executor->pending = co;
+    sched_exit_critical();
+
+    executor_wake(executor);
+}
+
+sched_tick_t sched_coro_poll(sched_coro_executor_t *executor)
+{
+    executor_merge_pending(executor);
+
+    sched_tick_t now = sched_get_tick_count();
+    sched_tick_t next = SCHED_WAIT_FOREVER;
+    sched_coro_t **link = &executor->head;
+    sched_coro_t *co;
+
+    while ((co = *link) != NULL) {
+        /* 未到期的延时协程只参与计算最近到期时刻 */
+        if (co->state == SCHED_CORO_DELAYED) {
+            int32_t remain = (int32_t)(co->wake_time - now);
+            if (remain > 0) {
+                if ((sched_tick_t)remain < next) {
+                    next = (sched_tick_t)remain;
+                }
+                link = &co->next;
+                continue;
+            }
+        }
+
+        co->func(co, co->param);
+
+        if (co->state == SCHED_CORO_DONE) {
+            *link = co->next;
+            co->next = NULL;
+            executor->count--;
+            continue;
+        }
+
+        if (co->state == SCHED_CORO_READY) {
+            next = 0;
+        } else if (co->state == SCHED_CORO_DELAYED) {
+            int32_t remain = (int32_t)(co->wake_time - sched_get_tick_count());
+            if (remain <= 0) {
+                next = 0;
+            } else if ((sched_tick_t)remain < next) {
+                next = (sched_tick_t)remain;
+            }
+        }
+
+        link = &co->next;
+    }
+
+    /* 本轮中启动的协程在下一轮运行 */
+    if (executor->pending) {
+        next = 0;
+    }
+
+    return next;
+}
+
+void sched_coro_run(sched_coro_executor_t *executor)
+{
+    executor->task = sched_get_current_task();
+
+    while (1) {
+        sched_tick_t timeout = sched_coro_poll(executor);
+
+        if (timeout == 0) {
+            /* 有协程让出：同优先级任务先运行一轮 */
+            sched_yield();
+        } else {
+            /* 等待最近的协程到期或事件发出 */
+            sched_task_notify_take(true, timeout);
+        }
+    }
+}
+
+uint32_t sched_coro_count(const sched_coro_executor_t *executor)
+{
+    return executor ? executor->count : 0;
+}
+
+/* ========================================================================
+ * 事件
+ * ======================================================================== */
+
+void sched_coro_event_init(sched_coro_event_t *event, sched_coro_executor_t *executor)
+{
+    if (!event) return;
+
+    event->count = 0;
+    event->executor = executor;
+}
+
+void sched_coro_event_signal(sched_coro_event_t *event)
+{
+    if (!event) return;
+
+    sched_enter_critical();
+    event->count++;
+    sched_exit_critical();
+
+    executor_wake(event->executor);
+}
+
+void sched_coro_event_signal_from_isr(sched_coro_event_t *event, bool *woken)
+{
+    if (!event) return;
+
+    sched_enter_critical();
+    event->count++;
+    sched_exit_critical();
+
+    task_handle_t task = event->executor->task;
+    if (task) {
+        sched_task_notify_from_isr(task, 0, SCHED_NOTIFY_INCREMENT, woken);
+    }
+}
+
+bool sched_coro_event_take(sched_coro_event_t *event)
+{
+    bool taken = false;
+
+    sched_enter_critical();
+    if (event->count > 0) {
+        event->count--;
+        taken = true;
+    }
+    sched_exit_critical();
+
+    return taken;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file    sched_internal.h
+ * @brief   调度器内核内部接口 (仅供 scheduler 模块内的同步原语使用)
+ *
+ * 除特别说明外，以下函数都必须在临界区内调用。
+ */
+
+#ifndef SCHED_INTERNAL_H
+#define SCHED_INTERNAL_H
+
+#include "scheduler.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * 阻塞当前任务到等待链表
+ *
+ * 任务按优先级插入 list；timeout 不为 SCHED_WAIT_FOREVER 时同时加入延时链表。
+ * 调用者退出临界区后需调用 sched_yield()，任务恢复运行时通过
+ * current->wait_signaled 判断是被唤醒 (true) 还是超时 (false)。
+ *
+ * @param list     等待链表
+ * @param timeout  超时滴答数 (不能为 0)
+ */
+void sched_block_current_on(sched_wait_list_t *list, sched_tick_t timeout);
+
+/**
+ * 唤醒等待链表中优先级最高的任务
+ *
+ * @return 被唤醒的任务，链表为空时返回 NULL
+ */
+tcb_t* sched_wake_first(sched_wait_list_t *list);
+
+/**
+ * 修改任务当前优先级 (用于优先级继承)，自动调整其在就绪队列/等待链表中的位置
+ */
+void sched_set_priority_internal(tcb_t *task, uint8_t priority);
+
+/**
+ * 是否有比当前任务优先级更高的就绪任务 (需要抢占)
+ */
+bool sched_need_preempt(void);
+
+/**
+ * 汇总 *_from_isr() 的抢占需求 (无需在临界区内)
+ *
+ * woken 非 NULL 时置位由调用者在中断退出前统一切换，否则立即挂起 PendSV
+ */
+void sched_isr_report_woken(bool preempt, bool *woken);
+
+/* ========================================================================
+ * 事件跟踪 (sched_trace.c)
+ * ======================================================================== */
+
+#if SCHED_TRACE
+#include "sched_trace.h"
+
+/**
+ * 配置 RTT 跟踪通道并写入 START 记录 (sched_init 调用)
+ */
+void sched_trace_init(void);
+
+/**
+ * 为任务分配跟踪编号并写入 TASK_CREATE 记录
+ */
+void sched_trace_task_create(tcb_t *task);
+
+/**
+ * 写入一条 8 字节事件记录
+ */
+void sched_trace_event(uint8_t type, uint8_t id, uint16_t arg);
+
+#define SCHED_TRACE_EVENT(type, task, arg) \
+    sched_trace_event((uint8_t)(type), (task)->trace_id, (uint16_t)(arg))
+#else
+#define SCHED_TRACE_EVENT(type, task, arg)  ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_INTERNAL_H */
@@ -0,0 +1,158 @@
+/**
+ * @file    sched_queue.c
+ * @brief   调度器消息队列实现
+ */
+
+#include "sched_queue.h"
+#include "sched_internal.h"
+#include <string.h>
+
+/* ========================================================================
+ * 内部辅助函数 (调用者需在临界区内)
+ * ======================================================================== */
+
+static void queue_push(sched_queue_t *queue, const void *item)
+{
+    memcpy(&queue->buffer[(uint32_t)queue->tail * queue->item_size], item, queue->item_size);
+    queue->tail = (uint16_t)((queue->tail + 1U == queue->capacity) ? 0U : queue->tail + 1U);
+    queue->count++;
+}
+
+static void queue_pop(sched_queue_t *queue, void *item)
+{
+    memcpy(item, &queue->buffer[(uint32_t)queue->head * queue->item_size], queue->item_size);
+    queue->head = (uint16_t)((queue->head + 1U == queue->capacity) ? 0U : queue->head + 1U);
+    queue->count--;
+}
+
+/**
+ * 计算剩余等待时间
+ *
+ * @return 剩余滴答数，0 表示已超时
+ */
+static sched_tick_t remaining_ticks(sched_tick_t timeout, sched_tick_t deadline)
+{
+    if (timeout == SCHED_WAIT_FOREVER) {
+        return SCHED_WAIT_FOREVER;
+    }
+
+    int32_t remain = (int32_t)(deadline - sched_get_tick_count());
+    return (remain > 0) ? (sched_tick_t)remain : 0;
+}
+
+/* ========================================================================
+ * 公共 API 实现
+ * ======================================================================== */
+
+void sched_queue_init(sched_queue_t *queue, void *buffer, uint16_t item_size, uint16_t capacity)
+{
+    if (!queue) return;
+
+    queue->buffer = (uint8_t *)buffer;
+    queue->item_size = item_size;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->count = 0;
+    queue->overflow_count = 0;
+    queue->recv_waiters.head = NULL;
+    queue->send_waiters.head = NULL;
+}
+
+bool sched_queue_send(sched_queue_t *queue, const void *item, sched_tick_t timeout)
+{
+    if (!queue || !item) return false;
+
+    sched_tick_t deadline = sched_get_tick_count() + timeout;
+
+    sched_enter_critical();
+
+    /* 被唤醒后空位可能已被更高优先级的发送者占用，需要重新检查 */
+    while (queue->count >= queue->capacity) {
+        sched_tick_t wait = remaining_ticks(timeout, deadline);
+        if (wait == 0) {
+            sched_exit_critical();
+            return false;
+        }
+
+        sched_block_current_on(&queue->send_waiters, wait);
+        sched_exit_critical();
+        sched_yield();
+        sched_enter_critical();
+    }
+
+    queue_push(queue, item);
+    sched_wake_first(&queue->recv_waiters);
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+
+    return true;
+}
+
+bool sched_queue_send_from_isr(sched_queue_t *queue, const void *item, bool *woken)
+{
+    if (!queue || !item) return false;
+
+    sched_enter_critical();
+
+    if (queue->count >= queue->capacity) {
+        queue->overflow_count++;
+        sched_exit_critical();
+        return false;
+    }
+
+    queue_push(queue, item);
+    sched_wake_first(&queue->recv_waiters);
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    sched_isr_report_woken(preempt, woken);
+
+    return true;
+}
+
+bool sched_queue_receive(sched_queue_t *queue, void *item, sched_tick_t timeout)
+{
+    if (!queue || !item) return false;
+
+    sched_tick_t deadline = sched_get_tick_count() + timeout;
+
+    sched_enter_critical();
+
+    /* 被唤醒后消息可能已被更高优先级的接收者取走，需要重新检查 */
+    while (queue->count == 0) {
+        sched_tick_t wait = remaining_ticks(timeout, deadline);
+        if (wait == 0) {
+            sched_exit_critical();
+            return false;
+        }
+
+        sched_block_current_on(&queue->recv_waiters, wait);
+        sched_exit_critical();
+        sched_yield();
+        sched_enter_critical();
+    }
+
+    queue_pop(queue, item);
+    sched_wake_first(&queue->send_waiters);
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+
+    return true;
+}
+
+uint16_t sched_queue_count(const sched_queue_t *queue)
+{
+    return queue ? queue->count : 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file    sched_sync.c
+ * @brief   调度器同步原语实现：优先级继承互斥锁、计数信号量
+ */
+
+#include "sched_sync.h"
+#include "sched_internal.h"
+
+/* ========================================================================
+ * 内部辅助函数
+ * ======================================================================== */
+
+/**
+ * 任务应有的优先级：基础优先级与所持各锁最高等待者中的较高者
+ */
+static uint8_t mutex_inherited_priority(const tcb_t *task)
+{
+    uint8_t priority = task->base_priority;
+
+    for (const sched_mutex_t *m = task->held_mutexes; m != NULL; m = m->held_next) {
+        const tcb_t *top = m->waiters.head;
+        if (top && top->priority > priority) {
+            priority = top->priority;
+        }
+    }
+
+    return priority;
+}
+
+/**
+ * 重新计算 task 的继承优先级，并沿 "等待的锁 -> 持有者" 链传递
+ *
+ * 提升 (新等待者) 与回落 (等待超时/解锁) 共用；修改优先级会重排任务在
+ * 等待链表中的位置，进而影响下一级持有者，因此逐级处理直到不再变化。
+ * 链长不超过任务数 (死锁成环时同样终止)。
+ */
+static void mutex_update_priority_chain(tcb_t *task)
+{
+    for (uint32_t depth = 0; task != NULL && depth < SCHED_MAX_TASKS; depth++) {
+        uint8_t priority = mutex_inherited_priority(task);
+        if (priority == task->priority) return;
+
+        sched_set_priority_internal(task, priority);
+
+        task = task->wait_mutex ? task->wait_mutex->owner : NULL;
+    }
+}
+
+static void mutex_held_add(tcb_t *task, sched_mutex_t *mutex)
+{
+    mutex->held_next = task->held_mutexes;
+    task->held_mutexes = mutex;
+}
+
+static void mutex_held_remove(tcb_t *task, sched_mutex_t *mutex)
+{
+    sched_mutex_t **link = &task->held_mutexes;
+
+    while (*link != NULL) {
+        if (*link == mutex) {
+            *link = mutex->held_next;
+            break;
+        }
+        link = &(*link)->held_next;
+    }
+
+    mutex->held_next = NULL;
+}
+
+/* ========================================================================
+ * 互斥锁
+ * ======================================================================== */
+
+void sched_mutex_init(sched_mutex_t *mutex)
+{
+    if (!mutex) return;
+
+    mutex->owner = NULL;
+    mutex->waiters.head = NULL;
+    mutex->held_next = NULL;
+}
+
+bool sched_mutex_lock(sched_mutex_t *mutex, sched_tick_t timeout)
+{
+    if (!mutex) return false;
+
+    tcb_t *self = sched_get_current_task();
+
+    sched_enter_critical();
+
+    /* 空闲：直接获取 */
+    if (mutex->owner == NULL) {
+        mutex->owner = self;
+        mutex_held_add(self, mutex);
+        sched_exit_critical();
+        return true;
+    }
+
+    /* 不可递归；不等待时立即返回 */
+    if (mutex->owner == self || timeout == 0) {
+        sched_exit_critical();
+        return false;
+    }
+
+    /* 优先级继承：持有者 (及其等待的锁的持有者，逐级) 提升到等待者优先级 */
+    sched_block_current_on(&mutex->waiters, timeout);
+    self->wait_mutex = mutex;
+    mutex_update_priority_chain(mutex->owner);
+    sched_exit_critical();
+
+    sched_yield();
+
+    /* 恢复运行：被唤醒表示解锁方已把所有权移交给本任务 */
+    sched_enter_critical();
+    bool acquired = self->wait_signaled;
+    self->wait_mutex = NULL;
+    if (!acquired && mutex->owner) {
+        /* 超时已离开等待链表：撤销经由本任务的继承 */
+        mutex_update_priority_chain(mutex->owner);
+    }
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+
+    return acquired;
+}
+
+bool sched_mutex_unlock(sched_mutex_t *mutex)
+{
+    if (!mutex) return false;
+
+    tcb_t *self = sched_get_current_task();
+
+    sched_enter_critical();
+
+    if (mutex->owner != self) {
+        sched_exit_critical();
+        return false;
+    }
+
+    mutex_held_remove(self, mutex);
+
+    /* 直接移交给最高优先级等待者 */
+    tcb_t *next_owner = sched_wake_first(&mutex->waiters);
+    mutex->owner = next_owner;
+    if (next_owner) {
+        /* 等待链表按优先级降序，剩余等待者不会高于新持有者，无需继承 */
+        next_owner->wait_mutex = NULL;
+        mutex_held_add(next_owner, mutex);
+    }
+
+    /* 只保留仍持有的锁带来的继承优先级 (没有则恢复基础优先级) */
+    sched_set_priority_internal(self, mutex_inherited_priority(self));
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+
+    return true;
+}
+
+/* ========================================================================
+ * 计数信号量
+ * ======================================================================== */
+
+void sched_sem_init(sched_sem_t *sem, uint32_t initial, uint32_t max_count)
+{
+    if (!sem) return;
+
+    sem->count = (initial > max_count) ? max_count : initial;
+    sem->max_count = max_count;
+    sem->waiters.head = NULL;
+}
+
+bool sched_sem_take(sched_sem_t *sem, sched_tick_t timeout)
+{
+    if (!sem) return false;
+
+    sched_enter_critical();
+
+    if (sem->count > 0) {
+        sem->count--;
+        sched_exit_critical();
+        return true;
+    }
+
+    if (timeout == 0) {
+        sched_exit_critical();
+        return false;
+    }
+
+    tcb_t *self = sched_get_current_task();
+    sched_block_current_on(&sem->waiters, timeout);
+    sched_exit_critical();
+
+    sched_yield();
+
+    /* 被唤醒表示释放方已把计数直接移交给本任务 */
+    return self->wait_signaled;
+}
+
+bool sched_sem_give(sched_sem_t *sem)
+{
+    if (!sem) return false;
+
+    sched_enter_critical();
+
+    if (sched_wake_first(&sem->waiters) == NULL) {
+        if (sem->count >= sem->max_count) {
+            sched_exit_critical();
+            return false;
+        }
+        sem->count++;
+    }
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+
+    return true;
+}
+
+bool sched_sem_give_from_isr(sched_sem_t *sem, bool *woken)
+{
+    if (!sem) return false;
+
+    sched_enter_critical();
+
+    if (sched_wake_first(&sem->waiters) == NULL) {
+        if (sem->count >= sem->max_count) {
+            sched_exit_critical();
+            return false;
+        }
+        sem->count++;
+    }
+
+    bool preempt = sched_need_preempt();
+    sched_exit_critical();
+
+    sched_isr_report_woken(preempt, woken);
+
+    return true;
+}
+
+uint32_t sched_sem_get_count(const sched_sem_t *sem)
+{
+    return sem ? sem->count : 0;
+}
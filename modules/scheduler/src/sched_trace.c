@@ -0,0 +1,160 @@
+/**
+ * @file    sched_trace.c
+ * @brief   内核事件跟踪实现 (SEGGER RTT 上行通道，非阻塞丢弃)
+ */
+
+#include "sched_trace.h"
+#include "sched_internal.h"
+
+#if SCHED_TRACE
+
+#include "SEGGER_RTT.h"
+#include <string.h>
+
+/* ========================================================================
+ * 私有变量
+ * ======================================================================== */
+
+static uint8_t  trace_buffer[SCHED_TRACE_BUFFER_SIZE];
+static uint32_t trace_dropped = 0;     /* 累计丢弃事件数 */
+static uint32_t trace_unreported = 0;  /* 尚未写入 OVERFLOW 记录的丢弃数 */
+static uint8_t  trace_next_id = 1;     /* 下一个任务编号 (0 保留) */
+static bool     trace_ready = false;   /* 通道已配置 (sched_init 之前的中断事件直接忽略) */
+
+/* ========================================================================
+ * 私有函数
+ * ======================================================================== */
+
+/**
+ * 写入一条完整记录 (调用者已屏蔽可调用内核的中断)
+ *
+ * 整条记录要么全部写入要么丢弃，主机端不会读到半条记录
+ */
+static void trace_put(const void *record, uint32_t size)
+{
+    if (!trace_ready) return;
+
+    if (trace_unreported > 0) {
+        uint16_t count = (trace_unreported > 0xFFFFU) ? 0xFFFFU : (uint16_t)trace_unreported;
+        sched_trace_record_t overflow = {
+            .timestamp = port_get_run_time_counter(),
+            .type      = SCHED_TRACE_OVERFLOW,
+            .id        = 0,
+            .arg       = count
+        };
+
+        if (SEGGER_RTT_WriteSkipNoLock(SCHED_TRACE_RTT_CHANNEL, &overflow, sizeof(overflow)) == 0) {
+            trace_dropped++;
+            trace_unreported++;
+            return;
+        }
+        trace_unreported -= count;
+    }
+
+    if (SEGGER_RTT_WriteSkipNoLock(SCHED_TRACE_RTT_CHANNEL, record, size) == 0) {
+        trace_dropped++;
+        trace_unreported++;
+    }
+}
+
+/**
+ * 写入带名称的记录 (仅在创建任务/命名中断时调用，不在热路径)
+ */
+static void trace_put_named(uint8_t type, uint8_t id, uint8_t extra, const char *name)
+{
+    struct {
+        sched_trace_record_t header;
+        char                 name[SCHED_TRACE_MAX_NAME_LEN];
+    } record;
+
+    uint32_t len = 0;
+    memset(record.name, 0, sizeof(record.name));
+    if (name) {
+        while (len < SCHED_TRACE_MAX_NAME_LEN && name[len] != '\0') {
+            record.name[len] = name[len];
+            len++;
+        }
+    }
+
+    record.header.timestamp = port_get_run_time_counter();
+    record.header.type = type;
+    record.header.id = id;
+    record.header.arg = (uint16_t)(extra | (len << 8));
+
+    trace_put(&record, sizeof(record.header) + ((len + 3U) & ~3U));
+}
+
+/* ========================================================================
+ * 内核内部接口 (sched_internal.h)
+ * ======================================================================== */
+
+void sched_trace_init(void)
+{
+    trace_dropped = 0;
+    trace_unreported = 0;
+    trace_next_id = 1;
+
+    SEGGER_RTT_ConfigUpBuffer(SCHED_TRACE_RTT_CHANNEL, "SchedTrace", trace_buffer,
+                              sizeof(trace_buffer), SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    trace_ready = true;
+
+    sched_trace_record_t start = {
+        .timestamp = port_get_run_time_counter_hz(),
+        .type      = SCHED_TRACE_START,
+        .id        = 0,
+        .arg       = SCHED_TRACE_VERSION
+    };
+    trace_put(&start, sizeof(start));
+}
+
+void sched_trace_event(uint8_t type, uint8_t id, uint16_t arg)
+{
+    sched_trace_record_t record = {
+        .timestamp = port_get_run_time_counter(),
+        .type      = type,
+        .id        = id,
+        .arg       = arg
+    };
+
+    trace_put(&record, sizeof(record));
+}
+
+void sched_trace_task_create(tcb_t *task)
+{
+    task->trace_id = trace_next_id;
+    trace_next_id = (trace_next_id == 0xFFU) ? 1U : (uint8_t)(trace_next_id + 1U);
+
+    trace_put_named(SCHED_TRACE_TASK_CREATE, task->trace_id, task->priority, task->name);
+}
+
+/* ========================================================================
+ * 公共 API 实现
+ * ======================================================================== */
+
+void sched_trace_isr_enter(uint8_t irq)
+{
+    sched_enter_critical();
+    sched_trace_event(SCHED_TRACE_ISR_ENTER, irq, 0);
+    sched_exit_critical();
+}
+
+void sched_trace_isr_exit(uint8_t irq)
+{
+    sched_enter_critical();
+    sched_trace_event(SCHED_TRACE_ISR_EXIT, irq, 0);
+    sched_exit_critical();
+}
+
+void sched_trace_isr_name(uint8_t irq, const char *name)
+{
+    sched_enter_critical();
+    trace_put_named(SCHED_TRACE_ISR_NAME, irq, 0, name);
+    sched_exit_critical();
+}
+
+uint32_t sched_trace_get_dropped(void)
+{
+    return trace_dropped;
+}
+
+#endif /* SCHED_TRACE */
@@ -4,24 +4,46 @@
  */
 
 #include "scheduler.h"
+#include "sched_internal.h"
 #include <string.h>
 
 /* CMSIS 内联函数 */
-#include "cmsis_compiler.h"
+#include "portmacro.h"
 
 /* ========================================================================
  * 内部数据结构
  * ======================================================================== */
 
-/* 任务栈池：静态分配在 DTCM RAM 的专用区域 */
-static uint8_t task_stack_pool[SCHED_MAX_TASKS][SCHED_DEFAULT_STACK_SIZE]
+/* 任务栈区：静态分配在 DTCM RAM 的专用区域，按任务实际需求切分 */
+static uint8_t task_stack_arena[SCHED_STACK_ARENA_SIZE]
     __attribute__((section(".task_stacks"), aligned(8)));
 
-/* 栈分配位图 */
-static uint16_t stack_allocated_bitmap = 0;
+/*
+ * 栈区块描述表 (带外管理，栈溢出不会破坏分配器元数据)
+ * 按地址升序排列，相邻空闲块在释放时合并；
+ * N 个已分配块最多把栈区切成 2N+1 块。
+ */
+#define STACK_MAX_BLOCKS    (2 * SCHED_MAX_TASKS + 1)
+
+typedef struct {
+    uint32_t offset;    /* 块起始偏移 (8 字节对齐) */
+    uint32_t size;      /* 块大小 (8 的倍数) */
+    bool     used;      /* 是否已分配 */
+} stack_block_t;
+
+static stack_block_t stack_blocks[STACK_MAX_BLOCKS];
+static uint32_t      stack_block_count = 0;
+
+/* 就绪队列：每个优先级一个双向链表 (头尾指针, 入队/出队均为 O(1)) */
+typedef struct {
+    tcb_t *head;
+    tcb_t *tail;
+} ready_list_t;
 
-/* 就绪队列：每个优先级一个链表 */
-static tcb_t *ready_queue[SCHED_MAX_PRIORITIES] = {NULL};
+static ready_list_t ready_queue[SCHED_MAX_PRIORITIES];
+
+/* 延时链表：按唤醒时刻 (block_time) 升序排列，表头即最早到期任务 */
+static tcb_t *delay_list = NULL;
 
 /* 任务池 */
 static tcb_t task_pool[SCHED_MAX_TASKS];
@@ -29,9 +51,24 @@ static tcb_t task_pool[SCHED_MAX_TASKS];
 /* 空闲 TCB 链表头 (用于回收) */
 static tcb_t *free_tcb_list = NULL;
 
-/* 已分配的任务数量 (用于快速查找上限) */
+/* 已分配的任务数量 (用于快速查找上限，含静态任务) */
 static uint32_t allocated_task_count = 0;
 
+/* 链接期任务表 (SCHED_TASK_DEFINE)，段边界由链接器提供 */
+#if defined(__ARMCC_VERSION)
+/* armlink 不提供 __start_/__stop_ 符号，scatter 文件须定义 ER_SCHED_TASK_TABLE 执行区 */
+extern const sched_task_desc_t Image$$ER_SCHED_TASK_TABLE$$Base[];
+extern const sched_task_desc_t Image$$ER_SCHED_TASK_TABLE$$Limit[];
+#define SCHED_TASK_TABLE_START  Image$$ER_SCHED_TASK_TABLE$$Base
+#define SCHED_TASK_TABLE_END    Image$$ER_SCHED_TASK_TABLE$$Limit
+#else
+/* GNU ld / 主机链接器：没有表项时为弱符号 NULL */
+extern const sched_task_desc_t __start_sched_task_table[] __attribute__((weak));
+extern const sched_task_desc_t __stop_sched_task_table[] __attribute__((weak));
+#define SCHED_TASK_TABLE_START  __start_sched_task_table
+#define SCHED_TASK_TABLE_END    __stop_sched_task_table
+#endif
+
 /* 当前运行任务 */
 static tcb_t *current_task = NULL;
 
@@ -44,132 +81,532 @@ static volatile uint32_t critical_nesting = 0;
 /* 调度器状态 */
 static bool scheduler_running = false;
 
-/* 优先级位图 (用于快速查找最高优先级) */
-static uint8_t ready_priority_bitmap = 0;
+/* 优先级位图 (bit n 置位表示优先级 n 有就绪任务，配合 CLZ 查找最高优先级) */
+static uint32_t ready_priority_bitmap = 0;
+
+#if SCHED_RUNTIME_STATS
+/* 运行时间统计 */
+static uint32_t last_switch_stamp = 0;    /* 最近一次切换时的周期计数 */
+static uint64_t retired_busy_time = 0;    /* 已删除的非空闲任务累计运行周期 */
+static uint32_t tick_count_high = 0;      /* tick_count 回绕次数 (经过时间按 64 位滴答计，不受 49.7 天回绕影响) */
+static tcb_t   *idle_task = NULL;         /* 调用 sched_idle_sleep() 的任务 */
+static tcb_t   *static_task_list = NULL;  /* 静态任务 (不在 task_pool 中) */
+#endif
+
+/* 任务通知状态 */
+#define NOTIFY_STATE_NONE       0   /* 无通知 */
+#define NOTIFY_STATE_WAITING    1   /* 任务阻塞等待通知 */
+#define NOTIFY_STATE_PENDING    2   /* 通知已到达，尚未被取走 */
+
+#if SCHED_USE_TICKLESS_IDLE
+/* 无滴答空闲接口 (移植层调用) */
+sched_tick_t sched_get_expected_idle_ticks(void);
+void sched_step_tick(sched_tick_t ticks);
+#endif
 
 /* ========================================================================
  * 内部辅助函数
  * ======================================================================== */
 
 /**
- * 从栈池分配栈空间
- * @return 栈索引，-1 表示失败
+ * 在描述表 index 处插入一个块
+ *
+ * @return false=描述表已满，未插入
+ */
+static bool stack_block_insert(uint32_t index, uint32_t offset, uint32_t size, bool used)
+{
+    if (stack_block_count >= STACK_MAX_BLOCKS) {
+        return false;
+    }
+
+    memmove(&stack_blocks[index + 1], &stack_blocks[index],
+            (stack_block_count - index) * sizeof(stack_block_t));
+    stack_blocks[index].offset = offset;
+    stack_blocks[index].size   = size;
+    stack_blocks[index].used   = used;
+    stack_block_count++;
+
+    return true;
+}
+
+/**
+ * 从描述表删除 index 处的块
+ */
+static void stack_block_remove(uint32_t index)
+{
+    stack_block_count--;
+    memmove(&stack_blocks[index], &stack_blocks[index + 1],
+            (stack_block_count - index) * sizeof(stack_block_t));
+}
+
+/**
+ * 从栈区分配栈空间 (最佳适配，减少碎片)
+ *
+ * @param size 栈大小 (字节, 已按 8 字节对齐)
+ * @return 栈底地址，NULL 表示失败
  */
-static int allocate_stack_from_pool(void)
+static sched_stack_t* allocate_stack_from_arena(uint32_t size)
 {
-    for (int i = 0; i < SCHED_MAX_TASKS; i++) {
-        if ((stack_allocated_bitmap & (1 << i)) == 0) {
-            stack_allocated_bitmap |= (1 << i);
-            return i;
+    uint32_t best = STACK_MAX_BLOCKS;
+
+    for (uint32_t i = 0; i < stack_block_count; i++) {
+        if (!stack_blocks[i].used && stack_blocks[i].size >= size) {
+            if (best == STACK_MAX_BLOCKS || stack_blocks[i].size < stack_blocks[best].size) {
+                best = i;
+            }
         }
     }
-    return -1;  /* 栈池已满 */
+
+    if (best == STACK_MAX_BLOCKS) {
+        return NULL;  /* 栈区不足 */
+    }
+
+    stack_block_t *block = &stack_blocks[best];
+    uint32_t remain = block->size - size;
+
+    block->used = true;
+    if (remain > 0 &&
+        stack_block_insert(best + 1, block->offset + size, remain, false)) {
+        /* 剩余部分切分为新的空闲块 (描述表已满时整块分配，不切分) */
+        stack_blocks[best].size = size;
+    }
+
+    return (sched_stack_t*)&task_stack_arena[stack_blocks[best].offset];
 }
 
 /**
- * 释放栈回池
- * @param stack_index 栈索引
+ * 释放栈回栈区，并与相邻空闲块合并
+ *
+ * @param stack_base 栈底地址
  */
-static void free_stack_to_pool(int stack_index)
+static void free_stack_to_arena(sched_stack_t *stack_base)
 {
-    if (stack_index >= 0 && stack_index < SCHED_MAX_TASKS) {
-        stack_allocated_bitmap &= ~(1 << stack_index);
+    uint32_t offset = (uint32_t)((uint8_t*)stack_base - task_stack_arena);
+
+    for (uint32_t i = 0; i < stack_block_count; i++) {
+        if (stack_blocks[i].offset != offset || !stack_blocks[i].used) continue;
+
+        stack_blocks[i].used = false;
+
+        /* 与后一块合并 */
+        if (i + 1 < stack_block_count && !stack_blocks[i + 1].used) {
+            stack_blocks[i].size += stack_blocks[i + 1].size;
+            stack_block_remove(i + 1);
+        }
+
+        /* 与前一块合并 */
+        if (i > 0 && !stack_blocks[i - 1].used) {
+            stack_blocks[i - 1].size += stack_blocks[i].size;
+            stack_block_remove(i);
+        }
+        return;
     }
 }
 
 /**
- * 将任务添加到就绪队列
+ * 将任务添加到就绪队列尾部 O(1)
+ *
+ * EDF 模式下周期任务按绝对截止期升序插入 (同截止期 FIFO)，
+ * 排在同优先级的非周期任务之前，O(同优先级周期任务数)
  */
 static void add_task_to_ready_queue(tcb_t *task)
 {
     if (!task) return;
 
     uint8_t prio = task->priority;
+    ready_list_t *list = &ready_queue[prio];
+    tcb_t *pos = NULL;  /* 插入到 pos 之前，NULL 表示队尾 */
+
+#if SCHED_USE_EDF
+    if (task->period != 0) {
+        pos = list->head;
+        while (pos && pos->period != 0 &&
+               (int32_t)(pos->abs_deadline - task->abs_deadline) <= 0) {
+            pos = pos->next;
+        }
+    }
+#endif
+
     task->state = TASK_READY;
+    task->next  = pos;
+    task->prev  = pos ? pos->prev : list->tail;
 
-    /* 添加到对应优先级的队列尾部 */
-    if (ready_queue[prio] == NULL) {
-        ready_queue[prio] = task;
-        task->next = task;  /* 循环链表 */
+    if (task->prev) {
+        task->prev->next = task;
     } else {
-        /* 插入到队列尾部 */
-        tcb_t *tail = ready_queue[prio];
-        while (tail->next != ready_queue[prio]) {
-            tail = tail->next;
-        }
-        tail->next = task;
-        task->next = ready_queue[prio];
+        list->head = task;
+    }
+    if (pos) {
+        pos->prev = task;
+    } else {
+        list->tail = task;
     }
 
     /* 更新优先级位图 */
-    ready_priority_bitmap |= (1 << prio);
+    ready_priority_bitmap |= (1UL << prio);
 }
 
 /**
- * 从就绪队列移除任务
+ * 从就绪队列移除任务 O(1)
+ *
+ * 只有 READY/RUNNING 态的任务在就绪队列中，其余状态直接忽略，
+ * 调用者必须在修改任务状态之前调用本函数。
  */
 static void remove_task_from_ready_queue(tcb_t *task)
 {
     if (!task) return;
+    if (task->state != TASK_READY && task->state != TASK_RUNNING) return;
 
     uint8_t prio = task->priority;
-    tcb_t *head = ready_queue[prio];
-
-    if (head == NULL) return;
+    ready_list_t *list = &ready_queue[prio];
 
-    /* 单节点情况 */
-    if (head->next == head) {
-        if (head == task) {
-            ready_queue[prio] = NULL;
-            ready_priority_bitmap &= ~(1 << prio);
-        }
-        return;
+    if (task->prev) {
+        task->prev->next = task->next;
+    } else {
+        list->head = task->next;
     }
 
-    /* 多节点情况 */
-    tcb_t *prev = head;
-    while (prev->next != task && prev->next != head) {
-        prev = prev->next;
+    if (task->next) {
+        task->next->prev = task->prev;
+    } else {
+        list->tail = task->prev;
     }
 
-    if (prev->next == task) {
-        prev->next = task->next;
-        if (task == head) {
-            ready_queue[prio] = task->next;
-        }
+    task->next = NULL;
+    task->prev = NULL;
 
-        /* 如果队列为空，清除位图 */
-        if (ready_queue[prio]->next == ready_queue[prio]) {
-            /* 仍有一个节点，不清除 */
-        }
+    /* 如果队列为空，清除位图 */
+    if (list->head == NULL) {
+        ready_priority_bitmap &= ~(1UL << prio);
     }
 }
 
 /**
- * 选择下一个运行的任务 (最高优先级)
+ * 选择下一个运行的任务 (最高优先级) O(1)
  */
 static tcb_t* select_next_task(void)
 {
-    /* 使用位图快速查找最高优先级 */
     if (ready_priority_bitmap == 0) {
         return NULL;  /* 空闲 */
     }
 
-    /* 找到最高优先级 (从高到低扫描) */
-    for (int i = SCHED_MAX_PRIORITIES - 1; i >= 0; i--) {
-        if (ready_priority_bitmap & (1 << i)) {
-            tcb_t *task = ready_queue[i];
+    /* CLZ 单指令定位最高置位, 即最高就绪优先级 */
+    uint32_t prio = 31UL - port_count_leading_zeros(ready_priority_bitmap);
+    ready_list_t *list = &ready_queue[prio];
+    tcb_t *task = list->head;
 
-            /* 时间片轮转：选择队列头，然后移动到下一个 */
-            if (task && task->next != task) {
-                ready_queue[i] = task->next;
-            }
+#if SCHED_USE_EDF
+    /* 队头是周期任务时其截止期最早，不参与时间片轮转 */
+    if (task->period != 0) {
+        return task;
+    }
+#endif
+
+    /* 时间片轮转：取出队列头，然后将其移到队尾 */
+    if (task != list->tail) {
+        list->head = task->next;
+        list->head->prev = NULL;
+
+        task->prev = list->tail;
+        task->next = NULL;
+        list->tail->next = task;
+        list->tail = task;
+    }
+
+    return task;
+}
+
+/**
+ * 将任务按唤醒时刻插入延时链表
+ *
+ * 使用溢出安全的比较 (int32_t)(a - b)，tick_count 回绕后顺序依然正确；
+ * 相同唤醒时刻的任务按插入顺序排列。
+ */
+static void add_task_to_delay_list(tcb_t *task, sched_tick_t wake_time)
+{
+    task->block_time = wake_time;
+
+    tcb_t *prev = NULL;
+    tcb_t *node = delay_list;
+    while (node && (int32_t)(node->block_time - wake_time) <= 0) {
+        prev = node;
+        node = node->delay_next;
+    }
+
+    task->delay_prev = prev;
+    task->delay_next = node;
+
+    if (prev) {
+        prev->delay_next = task;
+    } else {
+        delay_list = task;
+    }
+    if (node) {
+        node->delay_prev = task;
+    }
+}
+
+/**
+ * 从延时链表移除任务 O(1)，不在链表中时直接返回
+ */
+static void remove_task_from_delay_list(tcb_t *task)
+{
+    if (task->delay_prev == NULL && delay_list != task) return;
+
+    if (task->delay_prev) {
+        task->delay_prev->delay_next = task->delay_next;
+    } else {
+        delay_list = task->delay_next;
+    }
+    if (task->delay_next) {
+        task->delay_next->delay_prev = task->delay_prev;
+    }
+
+    task->delay_next = NULL;
+    task->delay_prev = NULL;
+}
+
+/**
+ * 阻塞当前任务到指定唤醒时刻 (调用者需在临界区内，退出后调用 sched_yield)
+ */
+static void delay_current_until(sched_tick_t wake_time)
+{
+    /* 从就绪队列移除 (需在修改状态之前) */
+    remove_task_from_ready_queue(current_task);
+
+    add_task_to_delay_list(current_task, wake_time);
+    current_task->state = TASK_BLOCKED;
+
+#if SCHED_TRACE
+    sched_tick_t ticks = wake_time - tick_count;
+    SCHED_TRACE_EVENT(SCHED_TRACE_DELAY, current_task, (ticks > 0xFFFFU) ? 0xFFFFU : ticks);
+#endif
+}
+
+/**
+ * 刚加入就绪队列的任务是否应抢占当前任务
+ *
+ * 优先级更高时抢占；EDF 模式下同优先级周期任务排到队头 (截止期最早) 时也抢占
+ */
+static bool task_preempts_current(const tcb_t *task)
+{
+    if (current_task == NULL || task == current_task) {
+        return false;
+    }
+
+    if (task->priority > current_task->priority) {
+        return true;
+    }
+
+#if SCHED_USE_EDF
+    if (task->period != 0 && task->priority == current_task->priority &&
+        ready_queue[task->priority].head == task) {
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+/**
+ * 将任务按优先级插入等待链表 (优先级降序，同优先级 FIFO)
+ */
+static void add_task_to_wait_list(sched_wait_list_t *list, tcb_t *task)
+{
+    tcb_t *prev = NULL;
+    tcb_t *node = list->head;
+    while (node && node->priority >= task->priority) {
+        prev = node;
+        node = node->wait_next;
+    }
+
+    task->wait_list = list;
+    task->wait_prev = prev;
+    task->wait_next = node;
+
+    if (prev) {
+        prev->wait_next = task;
+    } else {
+        list->head = task;
+    }
+    if (node) {
+        node->wait_prev = task;
+    }
+}
+
+/**
+ * 从所在等待链表移除任务 O(1)，未在等待时直接返回
+ */
+static void remove_task_from_wait_list(tcb_t *task)
+{
+    sched_wait_list_t *list = task->wait_list;
+    if (list == NULL) return;
+
+    if (task->wait_prev) {
+        task->wait_prev->wait_next = task->wait_next;
+    } else {
+        list->head = task->wait_next;
+    }
+    if (task->wait_next) {
+        task->wait_next->wait_prev = task->wait_prev;
+    }
+
+    task->wait_list = NULL;
+    task->wait_next = NULL;
+    task->wait_prev = NULL;
+}
+
+/**
+ * 阻塞当前任务等待通知 (调用者需在临界区内，退出后调用 sched_yield)
+ */
+static void block_current_for_notify(sched_tick_t timeout)
+{
+    remove_task_from_ready_queue(current_task);
+
+    if (timeout != SCHED_WAIT_FOREVER) {
+        add_task_to_delay_list(current_task, tick_count + timeout);
+    }
+
+    current_task->notify_state = NOTIFY_STATE_WAITING;
+    current_task->state = TASK_BLOCKED;
+    SCHED_TRACE_EVENT(SCHED_TRACE_BLOCK, current_task, SCHED_TRACE_BLOCK_NOTIFY);
+}
+
+/**
+ * 更新通知值并唤醒等待中的任务
+ *
+ * @return 是否需要抢占当前任务
+ */
+static bool notify_task(tcb_t *task, uint32_t value, sched_notify_action_t action)
+{
+    uint8_t prev_state = task->notify_state;
+    task->notify_state = NOTIFY_STATE_PENDING;
+
+    switch (action) {
+        case SCHED_NOTIFY_SET_BITS:
+            task->notify_value |= value;
+            break;
+
+        case SCHED_NOTIFY_INCREMENT:
+            task->notify_value++;
+            break;
+
+        case SCHED_NOTIFY_OVERWRITE:
+        default:
+            task->notify_value = value;
+            break;
+    }
+
+    if (prev_state == NOTIFY_STATE_WAITING) {
+        remove_task_from_delay_list(task);
+        add_task_to_ready_queue(task);
+        SCHED_TRACE_EVENT(SCHED_TRACE_READY, task, 0);
+        return sched_need_preempt();
+    }
+
+    return false;
+}
+
+/**
+ * 填充任务栈
+ *
+ * 开启水位线时填充整个栈，否则只填充栈底保护字
+ */
+static void paint_task_stack(tcb_t *task)
+{
+#if SCHED_STACK_WATERMARK
+    uint32_t words = task->stack_size / sizeof(sched_stack_t);
+#else
+    uint32_t words = SCHED_STACK_GUARD_WORDS;
+#endif
+
+    for (uint32_t i = 0; i < words; i++) {
+        task->stack_base[i] = SCHED_STACK_PAINT_PATTERN;
+    }
+}
+
+#if SCHED_STACK_OVERFLOW_CHECK
+/**
+ * 检查任务栈是否溢出
+ *
+ * 1. 保存的 SP 已进入保护区
+ * 2. 保护字被改写 (SP 曾越界后又回退)
+ */
+static bool task_stack_overflowed(const tcb_t *task)
+{
+    const sched_stack_t *guard = task->stack_base;
+
+    if (task->stack_ptr < guard + SCHED_STACK_GUARD_WORDS) {
+        return true;
+    }
 
-            return task;
+    for (uint32_t i = 0; i < SCHED_STACK_GUARD_WORDS; i++) {
+        if (guard[i] != SCHED_STACK_PAINT_PATTERN) {
+            return true;
         }
     }
 
-    return NULL;
+    return false;
+}
+#endif
+
+/**
+ * 唤醒延时链表中已到期的任务
+ *
+ * 链表有序，只需检查表头：无到期任务时 O(1) 返回
+ * @return 是否唤醒了比当前任务优先级更高的任务
+ */
+static bool wake_expired_tasks(void)
+{
+    bool need_schedule = false;
+
+    while (delay_list != NULL &&
+           (int32_t)(tick_count - delay_list->block_time) >= 0) {
+        tcb_t *task = delay_list;
+        remove_task_from_delay_list(task);
+
+        /* 等待同步对象超时 */
+        remove_task_from_wait_list(task);
+        task->wait_signaled = false;
+
+        /* 等待通知超时，之后到达的通知只置挂起不再重复唤醒 */
+        if (task->notify_state == NOTIFY_STATE_WAITING) {
+            task->notify_state = NOTIFY_STATE_NONE;
+        }
+
+        /* 超时，恢复到就绪队列 */
+        add_task_to_ready_queue(task);
+        SCHED_TRACE_EVENT(SCHED_TRACE_READY, task, 0);
+
+        /* FIX: 如果被唤醒的任务优先级更高 (或 EDF 下截止期更早)，立即抢占 */
+        if (task_preempts_current(task)) {
+            need_schedule = true;
+        }
+    }
+
+    return need_schedule;
+}
+
+#if SCHED_STACK_OVERFLOW_CHECK || SCHED_MPU_STACK_GUARD
+/**
+ * 栈溢出默认处理：停机，便于调试器查看 task->name
+ */
+__attribute__((weak)) void sched_stack_overflow_hook(task_handle_t task)
+{
+    (void)task;
+    sched_enter_critical();
+    while (1) {
+        /* 死循环 */
+    }
+}
+#endif
+
+/**
+ * 截止期错失默认处理：只计数 (deadline_misses)，不做其他动作
+ */
+__attribute__((weak)) void sched_deadline_miss_hook(task_handle_t task)
+{
+    (void)task;
 }
 
 /**
@@ -194,6 +631,9 @@ void sched_init(void)
     /* 清空所有数据结构 */
     memset(task_pool, 0, sizeof(task_pool));
     memset(ready_queue, 0, sizeof(ready_queue));
+#if SCHED_RUNTIME_STATS
+    static_task_list = NULL;
+#endif
 
     /* 初始化 TCB 空闲链表 */
     for (uint32_t i = 0; i < SCHED_MAX_TASKS; i++) {
@@ -207,102 +647,278 @@ void sched_init(void)
     critical_nesting = 0;
     scheduler_running = false;
     ready_priority_bitmap = 0;
-    stack_allocated_bitmap = 0;  /* 清空栈分配位图 */
+
+    /* 整个栈区初始化为一个空闲块 */
+    stack_blocks[0].offset = 0;
+    stack_blocks[0].size   = SCHED_STACK_ARENA_SIZE;
+    stack_blocks[0].used   = false;
+    stack_block_count = 1;
+
+    delay_list = NULL;
+
+#if SCHED_TRACE
+    sched_trace_init();
+#endif
 }
 
-task_handle_t sched_task_create(
+/**
+ * 初始化 TCB 与任务栈并加入就绪队列 (普通任务 period = 0)
+ *
+ * 周期参数在任务加入就绪队列之前设置：EDF 按截止期排队，且高优先级任务
+ * 可能在创建返回前就开始运行
+ */
+static task_handle_t task_init(
+    tcb_t          *task,
+    sched_stack_t  *stack_base,
+    uint32_t        stack_size,
     task_function_t task_func,
     const char     *name,
-    uint32_t        stack_size,
     void           *param,
-    uint8_t         priority
+    uint8_t         priority,
+    sched_tick_t    period,
+    sched_tick_t    deadline,
+    bool            static_alloc
 )
 {
-    if (priority >= SCHED_MAX_PRIORITIES) return NULL;
-
-    /* 从栈池分配栈空间 */
-    int stack_index = allocate_stack_from_pool();
-    if (stack_index < 0) {
-        return NULL;  /* 栈池已满 */
-    }
-
-    /* 从空闲 TCB 链表分配 TCB (FIX: 支持TCB回收) */
-    sched_enter_critical();
-    if (free_tcb_list == NULL) {
-        sched_exit_critical();
-        free_stack_to_pool(stack_index);
-        return NULL;  /* 没有空闲 TCB */
-    }
-
-    tcb_t *task = free_tcb_list;
-    free_tcb_list = free_tcb_list->next;
-    allocated_task_count++;
-    sched_exit_critical();
-
-    /* 使用预分配的栈 */
-    task->stack_base = (sched_stack_t*)task_stack_pool[stack_index];
-    task->stack_size = SCHED_DEFAULT_STACK_SIZE;
+    task->stack_base = stack_base;
+    task->stack_size = stack_size;
 
     /* 初始化 TCB */
     task->task_func = task_func;
     task->param = param;
     task->priority = priority;
+    task->base_priority = priority;
+    task->wait_mutex = NULL;
+    task->held_mutexes = NULL;
+    task->static_alloc = static_alloc;
+    task->wait_signaled = false;
+    task->notify_state = NOTIFY_STATE_NONE;
+    task->notify_value = 0;
+    task->period = period;
+    task->rel_deadline = deadline;
+    task->deadline_misses = 0;
+#if SCHED_RUNTIME_STATS
+    task->run_time = 0;
+    task->switch_count = 0;
+    task->static_next = NULL;
+#endif
     task->state = TASK_READY;
     task->time_slice = SCHED_TIME_SLICE_TICKS;
     task->block_time = 0;
     task->name = name;
     task->next = NULL;
+    task->prev = NULL;
+    task->delay_next = NULL;
+    task->delay_prev = NULL;
+    task->wait_list = NULL;
+    task->wait_next = NULL;
+    task->wait_prev = NULL;
+
+    /* 填充栈 (保护字 / 水位线) */
+    paint_task_stack(task);
 
     /* 初始化任务栈 (调用移植层) */
-    sched_stack_t *stack_top = task->stack_base + (SCHED_DEFAULT_STACK_SIZE / sizeof(sched_stack_t)) - 1;
+    sched_stack_t *stack_top = task->stack_base + (stack_size / sizeof(sched_stack_t)) - 1;
     task->stack_ptr = port_init_stack(stack_top, task_func, param);
 
-    /* 添加到就绪队列 */
+    /* 添加到就绪队列 (第一个作业在此刻释放) */
+    sched_enter_critical();
+#if SCHED_RUNTIME_STATS
+    if (static_alloc) {
+        task->static_next = static_task_list;
+        static_task_list = task;
+    }
+#endif
+    task->release_time = tick_count;
+    task->abs_deadline = tick_count + deadline;
+#if SCHED_TRACE
+    sched_trace_task_create(task);
+#endif
     add_task_to_ready_queue(task);
+    sched_exit_critical();
 
     return task;
 }
 
-void sched_task_delete(task_handle_t task)
+/**
+ * 从任务池与栈区分配并创建任务
+ */
+static task_handle_t task_create(
+    task_function_t task_func,
+    const char     *name,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority,
+    sched_tick_t    period,
+    sched_tick_t    deadline
+)
 {
-    if (!task) return;
+    if (priority >= SCHED_MAX_PRIORITIES) return NULL;
 
-    sched_enter_critical();
+    /* 超过栈区的请求直接拒绝 (同时避免下面的对齐运算回绕为 0) */
+    if (stack_size > SCHED_STACK_ARENA_SIZE) return NULL;
 
-    /* 从就绪队列移除 */
-    remove_task_from_ready_queue(task);
+    /* 栈大小：0 使用默认值，不足最小值时向上取整，并按 8 字节对齐 */
+    if (stack_size == 0) {
+        stack_size = SCHED_DEFAULT_STACK_SIZE;
+    } else if (stack_size < SCHED_MIN_STACK_SIZE) {
+        stack_size = SCHED_MIN_STACK_SIZE;
+    }
+    stack_size = (stack_size + 7UL) & ~7UL;
 
-    /* 释放栈回池 */
-    if (task->stack_base) {
-        /* 计算栈索引 */
-        uintptr_t stack_offset = (uintptr_t)task->stack_base - (uintptr_t)task_stack_pool;
-        int stack_index = stack_offset / SCHED_DEFAULT_STACK_SIZE;
+    sched_enter_critical();
 
-        /* 释放栈 */
-        free_stack_to_pool(stack_index);
-        task->stack_base = NULL;
+    /* 先检查空闲 TCB：已分配块数 < SCHED_MAX_TASKS 时切分栈区不会超出描述表 */
+    if (free_tcb_list == NULL) {
+        sched_exit_critical();
+        return NULL;  /* 没有空闲 TCB */
     }
 
-    task->state = TASK_DELETED;
+    /* 从栈区按需分配栈空间 */
+    sched_stack_t *stack_base = allocate_stack_from_arena(stack_size);
+    if (stack_base == NULL) {
+        sched_exit_critical();
+        return NULL;  /* 栈区不足 */
+    }
 
-    /* FIX: 将 TCB 放回空闲链表，支持任务回收 */
-    task->next = free_tcb_list;
-    free_tcb_list = task;
-    allocated_task_count--;
+    /* 从空闲 TCB 链表分配 TCB (FIX: 支持TCB回收) */
 
+    tcb_t *task = free_tcb_list;
+    free_tcb_list = free_tcb_list->next;
+    allocated_task_count++;
     sched_exit_critical();
 
-    /* 如果删除当前任务，立即切换 */
-    if (task == current_task) {
-        sched_yield();
-    }
+    return task_init(task, stack_base, stack_size, task_func, name, param, priority,
+                     period, deadline, false);
 }
 
-void sched_start(void)
-{
-    if (allocated_task_count == 0) {
-        /* 没有任务，无法启动 */
-        return;
+task_handle_t sched_task_create(
+    task_function_t task_func,
+    const char     *name,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority
+)
+{
+    return task_create(task_func, name, stack_size, param, priority, 0, 0);
+}
+
+task_handle_t sched_task_create_static(
+    task_function_t task_func,
+    const char     *name,
+    sched_stack_t  *stack,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority,
+    tcb_t          *tcb
+)
+{
+    if (priority >= SCHED_MAX_PRIORITIES || stack == NULL || tcb == NULL) return NULL;
+    if (((uintptr_t)stack & 7U) != 0) return NULL;  /* AAPCS 要求栈 8 字节对齐 */
+
+    /* 调用者的存储不能扩大，只向下取整 */
+    stack_size &= ~7UL;
+    if (stack_size < SCHED_MIN_STACK_SIZE) return NULL;
+
+    sched_enter_critical();
+    allocated_task_count++;
+    sched_exit_critical();
+
+    return task_init(tcb, stack, stack_size, task_func, name, param, priority, 0, 0, true);
+}
+
+task_handle_t sched_task_create_periodic(
+    task_function_t task_func,
+    const char     *name,
+    uint32_t        stack_size,
+    void           *param,
+    uint8_t         priority,
+    sched_tick_t    period,
+    sched_tick_t    deadline
+)
+{
+    if (deadline == 0) {
+        deadline = period;
+    }
+    if (period == 0 || deadline > period) return NULL;
+
+    return task_create(task_func, name, stack_size, param, priority, period, deadline);
+}
+
+void sched_task_delete(task_handle_t task)
+{
+    if (!task) return;
+
+    sched_enter_critical();
+
+    /* 从就绪队列 / 延时链表 / 等待链表移除 */
+    remove_task_from_ready_queue(task);
+    remove_task_from_delay_list(task);
+    remove_task_from_wait_list(task);
+    SCHED_TRACE_EVENT(SCHED_TRACE_TASK_DELETE, task, 0);
+
+    /* 释放移植层资源 (需在释放栈之前) */
+    port_clean_up_task(task);
+
+    /* 释放栈回栈区 (静态任务的栈归还调用者) */
+    if (task->stack_base && !task->static_alloc) {
+        free_stack_to_arena(task->stack_base);
+    }
+    task->stack_base = NULL;
+
+    task->state = TASK_DELETED;
+
+#if SCHED_RUNTIME_STATS
+    /* 保留已删除任务的运行时间，CPU 负载统计不因删除任务而回退 */
+    if (task != idle_task) {
+        retired_busy_time += task->run_time;
+    }
+    if (task == current_task) {
+        uint32_t now = port_get_run_time_counter();
+        if (task != idle_task) {
+            retired_busy_time += (uint32_t)(now - last_switch_stamp);
+        }
+        last_switch_stamp = now;
+    }
+#endif
+
+    if (task->static_alloc) {
+#if SCHED_RUNTIME_STATS
+        tcb_t **link = &static_task_list;
+        while (*link && *link != task) {
+            link = &(*link)->static_next;
+        }
+        if (*link) {
+            *link = task->static_next;
+        }
+#endif
+    } else {
+        /* FIX: 将 TCB 放回空闲链表，支持任务回收 */
+        task->next = free_tcb_list;
+        free_tcb_list = task;
+    }
+    allocated_task_count--;
+
+    sched_exit_critical();
+
+    /* 如果删除当前任务，立即切换 */
+    if (task == current_task) {
+        sched_yield();
+    }
+}
+
+void sched_start(void)
+{
+    /* 链接期任务表：直接使用表项中的 TCB 与栈，无运行时分配 */
+    for (const sched_task_desc_t *desc = SCHED_TASK_TABLE_START;
+         desc < SCHED_TASK_TABLE_END; desc++) {
+        sched_task_create_static(desc->task_func, desc->name, desc->stack, desc->stack_size,
+                                 desc->param, desc->priority, desc->tcb);
+    }
+
+    if (allocated_task_count == 0) {
+        /* 没有任务，无法启动 */
+        return;
     }
 
     scheduler_running = true;
@@ -314,6 +930,11 @@ void sched_start(void)
     current_task = select_next_task();
     if (current_task) {
         current_task->state = TASK_RUNNING;
+#if SCHED_RUNTIME_STATS
+        current_task->switch_count++;
+        last_switch_stamp = port_get_run_time_counter();
+#endif
+        SCHED_TRACE_EVENT(SCHED_TRACE_SWITCH_IN, current_task, 0);
     }
 
     /* 启动第一个任务 (永不返回) */
@@ -326,25 +947,334 @@ void sched_yield(void)
     port_yield();
 }
 
+void sched_yield_from_isr(bool woken)
+{
+    /* PendSV 为最低优先级，切换在所有中断退出后才发生 */
+    if (woken) {
+        port_yield();
+    }
+}
+
 void sched_delay(sched_tick_t ticks)
 {
     if (ticks == 0 || !scheduler_running) return;
 
     sched_enter_critical();
+    delay_current_until(tick_count + ticks);
+    sched_exit_critical();
 
-    /* 设置阻塞时间 */
-    current_task->block_time = tick_count + ticks;
-    current_task->state = TASK_BLOCKED;
+    /* 触发调度 */
+    sched_yield();
+}
 
-    /* 从就绪队列移除 */
-    remove_task_from_ready_queue(current_task);
+bool sched_delay_until(sched_tick_t *prev_wake_time, sched_tick_t increment)
+{
+    if (!prev_wake_time || !scheduler_running) return false;
+
+    sched_enter_critical();
+
+    sched_tick_t wake_time = *prev_wake_time + increment;
+    *prev_wake_time = wake_time;
+
+    /* 唤醒时刻已过 (含正好等于当前滴答) 时不阻塞 */
+    bool delayed = (int32_t)(wake_time - tick_count) > 0;
+    if (delayed) {
+        delay_current_until(wake_time);
+    }
 
     sched_exit_critical();
 
-    /* 触发调度 */
-    sched_yield();
+    if (delayed) {
+        sched_yield();
+    }
+
+    return delayed;
+}
+
+bool sched_task_wait_next_period(void)
+{
+    tcb_t *task = current_task;
+    if (!task || task->period == 0 || !scheduler_running) return false;
+
+    /* 1. 完成时刻与截止期比较 */
+    sched_enter_critical();
+    bool missed = (int32_t)(tick_count - task->abs_deadline) > 0;
+    if (missed) {
+        task->deadline_misses++;
+    }
+    sched_exit_critical();
+
+    if (missed) {
+        sched_deadline_miss_hook(task);
+    }
+
+    /* 2. 释放下一个作业 */
+    sched_enter_critical();
+
+    sched_tick_t now = tick_count;
+    task->release_time += task->period;
+
+    int32_t behind = (int32_t)(now - task->release_time);
+    if (behind > 0 && (sched_tick_t)behind >= task->period) {
+        /* 跳过整周期错过的释放点，被跳过的作业计为错失 */
+        sched_tick_t skipped = (sched_tick_t)behind / task->period;
+        task->release_time += skipped * task->period;
+        task->deadline_misses += skipped;
+    }
+    task->abs_deadline = task->release_time + task->rel_deadline;
+
+    bool delayed = (int32_t)(task->release_time - now) > 0;
+    bool yield = delayed;
+    if (delayed) {
+        delay_current_until(task->release_time);
+    }
+#if SCHED_USE_EDF
+    else {
+        /* 立即开始下一作业：截止期推后，按新截止期重新排队 */
+        remove_task_from_ready_queue(task);
+        add_task_to_ready_queue(task);
+        task->state = TASK_RUNNING;
+        yield = (ready_queue[task->priority].head != task);
+    }
+#endif
+
+    sched_exit_critical();
+
+    if (yield) {
+        sched_yield();
+    }
+
+    return !missed;
 }
 
+uint32_t sched_task_get_deadline_misses(task_handle_t task)
+{
+    if (task == NULL) {
+        task = current_task;
+    }
+
+    return task ? task->deadline_misses : 0;
+}
+
+void sched_task_notify(task_handle_t task, uint32_t value, sched_notify_action_t action)
+{
+    if (!task) return;
+
+    sched_enter_critical();
+    bool preempt = notify_task(task, value, action);
+    sched_exit_critical();
+
+    if (preempt) {
+        sched_yield();
+    }
+}
+
+void sched_task_notify_from_isr(task_handle_t task, uint32_t value,
+                                sched_notify_action_t action, bool *woken)
+{
+    if (!task) return;
+
+    sched_enter_critical();
+    bool preempt = notify_task(task, value, action);
+    sched_exit_critical();
+
+    sched_isr_report_woken(preempt, woken);
+}
+
+bool sched_task_notify_wait(uint32_t clear_on_entry, uint32_t clear_on_exit,
+                            uint32_t *value, sched_tick_t timeout)
+{
+    sched_enter_critical();
+
+    if (current_task->notify_state != NOTIFY_STATE_PENDING) {
+        current_task->notify_value &= ~clear_on_entry;
+
+        if (timeout > 0) {
+            block_current_for_notify(timeout);
+            sched_exit_critical();
+            sched_yield();
+            sched_enter_critical();
+        }
+    }
+
+    bool received = (current_task->notify_state == NOTIFY_STATE_PENDING);
+    if (value) {
+        *value = current_task->notify_value;
+    }
+    if (received) {
+        current_task->notify_value &= ~clear_on_exit;
+    }
+    current_task->notify_state = NOTIFY_STATE_NONE;
+
+    sched_exit_critical();
+
+    return received;
+}
+
+uint32_t sched_task_notify_take(bool clear_on_exit, sched_tick_t timeout)
+{
+    sched_enter_critical();
+
+    if (current_task->notify_value == 0 && timeout > 0) {
+        block_current_for_notify(timeout);
+        sched_exit_critical();
+        sched_yield();
+        sched_enter_critical();
+    }
+
+    uint32_t value = current_task->notify_value;
+    if (value != 0) {
+        current_task->notify_value = clear_on_exit ? 0 : value - 1;
+    }
+    current_task->notify_state = NOTIFY_STATE_NONE;
+
+    sched_exit_critical();
+
+    return value;
+}
+
+void sched_idle_sleep(void)
+{
+#if SCHED_RUNTIME_STATS
+    idle_task = current_task;
+#endif
+
+#if SCHED_USE_TICKLESS_IDLE
+    sched_enter_critical();
+    sched_tick_t expected = sched_get_expected_idle_ticks();
+    sched_exit_critical();
+
+    if (expected >= SCHED_TICKLESS_MIN_IDLE_TICKS) {
+        port_suppress_ticks_and_sleep(expected);
+        return;
+    }
+#endif
+    port_wait_for_interrupt();
+}
+
+#if SCHED_RUNTIME_STATS
+/**
+ * 累加单个任务的运行时间，并在容量允许时写入快照数组
+ */
+static void runtime_stats_add(const tcb_t *task, uint32_t partial, uint64_t *busy,
+                              sched_task_runtime_t *tasks, uint32_t max_tasks, uint32_t *count)
+{
+    uint64_t run_time = task->run_time;
+    if (task == current_task) {
+        run_time += partial;  /* 当前任务尚未结算的部分 */
+    }
+    if (task != idle_task) {
+        *busy += run_time;
+    }
+
+    if (tasks && *count < max_tasks) {
+        tasks[*count].name = task->name;
+        tasks[*count].priority = task->priority;
+        tasks[*count].state = task->state;
+        tasks[*count].run_time = run_time;
+        tasks[*count].switch_count = task->switch_count;
+        (*count)++;
+    }
+}
+
+uint32_t sched_get_runtime_stats(sched_task_runtime_t *tasks, uint32_t max_tasks,
+                                 sched_runtime_summary_t *summary)
+{
+    uint32_t count = 0;
+
+    sched_enter_critical();
+
+    /* 64 位读取与任务删除时的结算都在临界区内，避免撕裂或漏计 */
+    uint64_t busy = retired_busy_time;
+
+    /* 当前任务尚未结算的部分 */
+    uint32_t partial = port_get_run_time_counter() - last_switch_stamp;
+    uint64_t ticks = ((uint64_t)tick_count_high << 32) | tick_count;
+
+    for (uint32_t i = 0; i < SCHED_MAX_TASKS; i++) {
+        const tcb_t *task = &task_pool[i];
+        if (task->stack_base == NULL) continue;  /* 未分配或已删除 */
+
+        runtime_stats_add(task, partial, &busy, tasks, max_tasks, &count);
+    }
+
+    for (const tcb_t *task = static_task_list; task != NULL; task = task->static_next) {
+        runtime_stats_add(task, partial, &busy, tasks, max_tasks, &count);
+    }
+
+    sched_exit_critical();
+
+    if (summary) {
+        summary->elapsed = ticks * (port_get_run_time_counter_hz() / SCHED_TICK_RATE_HZ);
+        summary->busy = busy;
+        summary->cpu_load_pct10 = 0;
+        if (summary->elapsed > 0) {
+            uint64_t load = busy * 1000U / summary->elapsed;
+            summary->cpu_load_pct10 = (uint16_t)((load > 1000U) ? 1000U : load);
+        }
+    }
+
+    return count;
+}
+#endif
+
+void sched_get_stack_arena_info(sched_stack_arena_info_t *info)
+{
+    if (!info) return;
+
+    memset(info, 0, sizeof(*info));
+    info->total_size = SCHED_STACK_ARENA_SIZE;
+
+    sched_enter_critical();
+    for (uint32_t i = 0; i < stack_block_count; i++) {
+        const stack_block_t *block = &stack_blocks[i];
+        if (block->used) {
+            info->used_size += block->size;
+            info->used_blocks++;
+        } else {
+            info->free_size += block->size;
+            info->free_blocks++;
+            if (block->size > info->largest_free_block) {
+                info->largest_free_block = block->size;
+            }
+        }
+    }
+    sched_exit_critical();
+
+    /* 碎片率 = 1 - 最大空闲块 / 空闲总量 */
+    if (info->free_size > 0) {
+        info->fragmentation_pct =
+            (uint8_t)(100UL - (info->largest_free_block * 100UL) / info->free_size);
+    }
+}
+
+#if SCHED_STACK_WATERMARK
+uint32_t sched_task_get_stack_high_water(task_handle_t task)
+{
+    if (task == NULL) {
+        task = current_task;
+    }
+    if (task == NULL || task->stack_base == NULL) {
+        return 0;
+    }
+
+    /* 栈向下生长：从栈底向上统计仍保持填充值的字 */
+    uint32_t words = task->stack_size / sizeof(sched_stack_t);
+    uint32_t start = 0;
+#if SCHED_MPU_STACK_GUARD
+    /* 从 MPU 保护区之上开始统计 (当前任务的保护区不可读，栈到达保护区即溢出) */
+    start = (uint32_t)((SCHED_MPU_GUARD_BASE(task->stack_base) + SCHED_MPU_GUARD_SIZE -
+                        (uintptr_t)task->stack_base) / sizeof(sched_stack_t));
+#endif
+    uint32_t unused = start;
+    while (unused < words && task->stack_base[unused] == SCHED_STACK_PAINT_PATTERN) {
+        unused++;
+    }
+
+    return (unused - start) * sizeof(sched_stack_t);
+}
+#endif
+
 sched_tick_t sched_get_tick_count(void)
 {
     return tick_count;
@@ -357,7 +1287,7 @@ task_handle_t sched_get_current_task(void)
 
 void sched_enter_critical(void)
 {
-    __disable_irq();
+    port_disable_interrupts();
     critical_nesting++;
 }
 
@@ -366,7 +1296,7 @@ void sched_exit_critical(void)
     if (critical_nesting > 0) {
         critical_nesting--;
         if (critical_nesting == 0) {
-            __enable_irq();
+            port_enable_interrupts();
         }
     }
 }
@@ -382,6 +1312,23 @@ void sched_switch_context(void)
 {
     /* 保存当前任务的栈指针已在汇编中完成 */
 
+#if SCHED_STACK_OVERFLOW_CHECK
+    /* 检查出栈任务 (已删除任务的栈已释放，跳过) */
+    if (current_task && current_task->stack_base &&
+        task_stack_overflowed(current_task)) {
+        sched_stack_overflow_hook(current_task);
+    }
+#endif
+
+#if SCHED_RUNTIME_STATS
+    /* 出栈任务累加本次运行周期 (已删除任务在删除时已结算) */
+    uint32_t now = port_get_run_time_counter();
+    if (current_task && current_task->stack_base) {
+        current_task->run_time += (uint32_t)(now - last_switch_stamp);
+    }
+    last_switch_stamp = now;
+#endif
+
     /* 选择下一个任务 */
     tcb_t *next_task = select_next_task();
 
@@ -391,6 +1338,15 @@ void sched_switch_context(void)
             current_task->state = TASK_READY;
         }
 
+#if SCHED_RUNTIME_STATS || SCHED_TRACE
+        if (next_task != current_task) {
+#if SCHED_RUNTIME_STATS
+            next_task->switch_count++;
+#endif
+            SCHED_TRACE_EVENT(SCHED_TRACE_SWITCH_IN, next_task, 0);
+        }
+#endif
+
         /* 切换到新任务 */
         current_task = next_task;
         current_task->state = TASK_RUNNING;
@@ -408,25 +1364,21 @@ void sched_switch_context(void)
 void sched_tick_handler(void)
 {
     tick_count++;
+#if SCHED_RUNTIME_STATS
+    if (tick_count == 0) {
+        tick_count_high++;
+    }
+#endif
+
+#if SCHED_TRACE
+    sched_trace_event(SCHED_TRACE_TICK, 0, (uint16_t)tick_count);
+#endif
 
     bool need_schedule = false;
 
-    /* 检查阻塞任务是否超时 */
-    for (uint32_t i = 0; i < SCHED_MAX_TASKS; i++) {
-        tcb_t *task = &task_pool[i];
-        if (task->state == TASK_BLOCKED) {
-            /* 使用溢出安全的比较：(int32_t)差值 >= 0 */
-            int32_t diff = (int32_t)(tick_count - task->block_time);
-            if (diff >= 0) {
-                /* 超时，恢复到就绪队列 */
-                add_task_to_ready_queue(task);
-
-                /* FIX: 如果被唤醒的任务优先级更高，立即抢占 */
-                if (current_task && task->priority > current_task->priority) {
-                    need_schedule = true;
-                }
-            }
-        }
+    /* 唤醒到期任务 */
+    if (wake_expired_tasks()) {
+        need_schedule = true;
     }
 
     /* 时间片递减 */
@@ -445,6 +1397,144 @@ void sched_tick_handler(void)
     }
 }
 
+#if SCHED_USE_TICKLESS_IDLE
+/**
+ * 计算预计空闲滴答数 (由空闲任务/移植层调用，调用者需关中断)
+ *
+ * @return 0 表示除调用者外还有就绪任务，不能停止滴答；
+ *         无延时任务时返回 UINT32_MAX，由移植层按硬件上限截断
+ */
+sched_tick_t sched_get_expected_idle_ticks(void)
+{
+    sched_tick_t expected = 0;
+
+    /* 只有当前任务就绪 (其优先级队列只有它自己，且无其他优先级就绪) */
+    if (current_task &&
+        ready_priority_bitmap == (1UL << current_task->priority) &&
+        ready_queue[current_task->priority].head == ready_queue[current_task->priority].tail) {
+        if (delay_list == NULL) {
+            expected = UINT32_MAX;
+        } else {
+            int32_t remain = (int32_t)(delay_list->block_time - tick_count);
+            expected = (remain > 0) ? (sched_tick_t)remain : 0;
+        }
+    }
+
+    return expected;
+}
+
+/**
+ * 补偿无滴答睡眠期间错过的滴答 (由移植层在唤醒后调用，中断已关闭)
+ *
+ * 推进 tick_count 并立即唤醒到期任务，需要时挂起 PendSV
+ */
+void sched_step_tick(sched_tick_t ticks)
+{
+#if SCHED_RUNTIME_STATS
+    if (tick_count + ticks < tick_count) {
+        tick_count_high++;
+    }
+#endif
+    tick_count += ticks;
+
+#if SCHED_TRACE
+    sched_trace_event(SCHED_TRACE_TICK, 0, (uint16_t)tick_count);
+#endif
+
+    if (wake_expired_tasks()) {
+        sched_yield();
+    }
+}
+#endif
+
+/* ========================================================================
+ * 同步原语内部接口 (sched_internal.h)
+ * ======================================================================== */
+
+void sched_block_current_on(sched_wait_list_t *list, sched_tick_t timeout)
+{
+    /* 从就绪队列移除 (需在修改状态之前) */
+    remove_task_from_ready_queue(current_task);
+
+    add_task_to_wait_list(list, current_task);
+    if (timeout != SCHED_WAIT_FOREVER) {
+        add_task_to_delay_list(current_task, tick_count + timeout);
+    }
+
+    current_task->wait_signaled = false;
+    current_task->state = TASK_BLOCKED;
+    SCHED_TRACE_EVENT(SCHED_TRACE_BLOCK, current_task, SCHED_TRACE_BLOCK_SYNC);
+}
+
+tcb_t* sched_wake_first(sched_wait_list_t *list)
+{
+    tcb_t *task = list->head;
+    if (task == NULL) return NULL;
+
+    remove_task_from_wait_list(task);
+    remove_task_from_delay_list(task);
+
+    task->wait_signaled = true;
+    add_task_to_ready_queue(task);
+    SCHED_TRACE_EVENT(SCHED_TRACE_READY, task, 0);
+
+    return task;
+}
+
+void sched_set_priority_internal(tcb_t *task, uint8_t priority)
+{
+    if (task->priority == priority) return;
+
+    if (task->state == TASK_READY || task->state == TASK_RUNNING) {
+        /* 在就绪队列中：移到新优先级队尾，保留运行态 */
+        task_state_t state = task->state;
+        remove_task_from_ready_queue(task);
+        task->priority = priority;
+        add_task_to_ready_queue(task);
+        task->state = state;
+    } else if (task->wait_list) {
+        /* 在等待链表中：按新优先级重新排序 */
+        sched_wait_list_t *list = task->wait_list;
+        remove_task_from_wait_list(task);
+        task->priority = priority;
+        add_task_to_wait_list(list, task);
+    } else {
+        task->priority = priority;
+    }
+}
+
+bool sched_need_preempt(void)
+{
+    if (current_task == NULL || ready_priority_bitmap == 0) {
+        return false;
+    }
+
+    if ((31UL - port_count_leading_zeros(ready_priority_bitmap)) > current_task->priority) {
+        return true;
+    }
+
+#if SCHED_USE_EDF
+    /* 同优先级周期任务排在当前任务之前：截止期更早 */
+    const tcb_t *head = ready_queue[current_task->priority].head;
+    if (head != current_task && head != NULL && head->period != 0) {
+        return true;
+    }
+#endif
+
+    return false;
+}
+
+void sched_isr_report_woken(bool preempt, bool *woken)
+{
+    if (!preempt) return;
+
+    if (woken) {
+        *woken = true;
+    } else {
+        port_yield();
+    }
+}
+
 /**
  * 获取当前任务的栈指针 (用于上下文切换)
  */
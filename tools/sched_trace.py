@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+sched_trace.py - 将调度器内核事件跟踪 (SCHED_TRACE) 转换为 Chrome Trace JSON
+
+输入为 RTT 跟踪通道 (默认通道 1) 的原始二进制数据：
+- 硬件：J-Link RTT Logger 保存，例如
+      JLinkRTTLogger -Device STM32F407ZG -If SWD -Speed 4000 -RTTChannel 1 trace.bin
+- POSIX 仿真板：SCHED_TRACE_FILE=trace.bin ./sched_bench_posix
+
+输出可直接拖入 https://ui.perfetto.dev 或 chrome://tracing 查看：
+- 每个任务一条轨道，运行区间显示为时间片
+- 每个中断编号一条轨道 (sched_trace_isr_enter/exit)
+- 延时/阻塞/就绪/丢弃为瞬时事件，滴答单独一条轨道
+
+用法：
+    python sched_trace.py trace.bin -o trace.json
+    python sched_trace.py trace.bin --hz 168000000 --no-ticks
+"""
+
+import sys
+import json
+import struct
+import argparse
+from pathlib import Path
+
+# 记录格式定义（与 sched_trace.h 保持一致）
+RECORD = struct.Struct('<IBBH')
+TRACE_VERSION = 1
+
+EV_START = 0
+EV_TASK_CREATE = 1
+EV_TASK_DELETE = 2
+EV_SWITCH_IN = 3
+EV_TICK = 4
+EV_DELAY = 5
+EV_BLOCK = 6
+EV_READY = 7
+EV_ISR_ENTER = 8
+EV_ISR_EXIT = 9
+EV_ISR_NAME = 10
+EV_OVERFLOW = 11
+
+BLOCK_REASONS = {0: 'notify', 1: 'sync'}
+
+# Chrome Trace 轨道编号
+PID = 1
+TID_TICK = 999
+TID_ISR_BASE = 1000
+
+
+class TraceError(Exception):
+    pass
+
+
+def parse_records(data):
+    """逐条解析记录，产出 (offset, timestamp, type, id, arg, name)"""
+    offset = 0
+    while offset + RECORD.size <= len(data):
+        timestamp, ev_type, ev_id, arg = RECORD.unpack_from(data, offset)
+        name = None
+        size = RECORD.size
+
+        if ev_type in (EV_TASK_CREATE, EV_ISR_NAME):
+            name_len = arg >> 8
+            padded = (name_len + 3) & ~3
+            if offset + size + padded > len(data):
+                break
+            raw = data[offset + size:offset + size + name_len]
+            name = raw.decode('utf-8', errors='replace')
+            size += padded
+        elif ev_type > EV_OVERFLOW:
+            raise TraceError(f"偏移 0x{offset:x}: 未知事件类型 {ev_type}")
+
+        yield offset, timestamp, ev_type, ev_id, arg, name
+        offset += size
+
+    if offset != len(data):
+        print(f"警告: 末尾 {len(data) - offset} 字节不完整，已忽略", file=sys.stderr)
+
+
+class Converter:
+    """按时间顺序回放记录，生成 Chrome Trace 事件"""
+
+    def __init__(self, hz=None, ticks=True):
+        self.hz = hz
+        self.ticks = ticks
+        self.events = []
+        self.tasks = {}            # trace_id -> (name, priority)
+        self.isr_names = {}
+        self.running = None        # (trace_id, 开始时间 us)
+        self.isr_open = {}         # irq -> 开始时间 us
+        self.last_raw = None
+        self.wraps = 0
+        self.dropped = 0
+        self.counts = {}
+
+    def us(self, raw):
+        """32 位计数器展开为单调时间 (微秒)"""
+        if self.last_raw is not None and raw < self.last_raw:
+            self.wraps += 1
+        self.last_raw = raw
+        return ((self.wraps << 32) + raw) * 1e6 / self.hz
+
+    def instant(self, name, tid, ts, args=None, scope='t'):
+        ev = {'name': name, 'ph': 'i', 's': scope, 'pid': PID, 'tid': tid, 'ts': ts}
+        if args:
+            ev['args'] = args
+        self.events.append(ev)
+
+    def close_running(self, ts):
+        if self.running is None:
+            return
+        trace_id, start = self.running
+        name = self.tasks.get(trace_id, (f'task{trace_id}', 0))[0]
+        self.events.append({'name': name, 'ph': 'X', 'pid': PID, 'tid': trace_id,
+                            'ts': start, 'dur': max(ts - start, 0)})
+        self.running = None
+
+    def feed(self, ev_type, ev_id, arg, name, raw):
+        self.counts[ev_type] = self.counts.get(ev_type, 0) + 1
+
+        if ev_type == EV_START:
+            if arg != TRACE_VERSION:
+                raise TraceError(f"不支持的跟踪格式版本 {arg}")
+            if self.hz is None:
+                self.hz = raw
+            self.last_raw = None
+            self.wraps = 0
+            return
+
+        if self.hz is None or self.hz == 0:
+            raise TraceError("缺少 START 记录 (跟踪开头已丢失)，请用 --hz 指定计数器频率")
+
+        ts = self.us(raw)
+
+        if ev_type == EV_TASK_CREATE:
+            self.tasks[ev_id] = (name, arg & 0xFF)
+        elif ev_type == EV_TASK_DELETE:
+            if self.running and self.running[0] == ev_id:
+                self.close_running(ts)
+            self.instant('delete', ev_id, ts)
+        elif ev_type == EV_SWITCH_IN:
+            # TASK_CREATE 记录被丢弃时仍为任务建轨道
+            self.tasks.setdefault(ev_id, (f'task{ev_id}', 0))
+            self.close_running(ts)
+            self.running = (ev_id, ts)
+        elif ev_type == EV_TICK:
+            if self.ticks:
+                self.instant('tick', TID_TICK, ts, {'tick': arg})
+        elif ev_type == EV_DELAY:
+            self.instant('delay', ev_id, ts, {'ticks': arg})
+        elif ev_type == EV_BLOCK:
+            self.instant('block', ev_id, ts,
+                         {'reason': BLOCK_REASONS.get(arg, str(arg))})
+        elif ev_type == EV_READY:
+            self.instant('ready', ev_id, ts)
+        elif ev_type == EV_ISR_ENTER:
+            self.isr_open[ev_id] = ts
+        elif ev_type == EV_ISR_EXIT:
+            start = self.isr_open.pop(ev_id, None)
+            if start is not None:
+                self.events.append({'name': self.isr_names.get(ev_id, f'irq{ev_id}'), 'ph': 'X',
+                                    'pid': PID, 'tid': TID_ISR_BASE + ev_id,
+                                    'ts': start, 'dur': max(ts - start, 0)})
+        elif ev_type == EV_ISR_NAME:
+            self.isr_names[ev_id] = name
+        elif ev_type == EV_OVERFLOW:
+            self.dropped += arg
+            self.instant('overflow', 0, ts, {'dropped': arg}, scope='g')
+
+    def finish(self):
+        if self.running is not None and self.last_raw is not None:
+            self.close_running(((self.wraps << 32) + self.last_raw) * 1e6 / self.hz)
+
+        meta = [{'name': 'process_name', 'ph': 'M', 'pid': PID, 'args': {'name': 'scheduler'}}]
+        for trace_id, (name, prio) in sorted(self.tasks.items()):
+            meta.append({'name': 'thread_name', 'ph': 'M', 'pid': PID, 'tid': trace_id,
+                         'args': {'name': f'{name} (prio {prio})'}})
+            meta.append({'name': 'thread_sort_index', 'ph': 'M', 'pid': PID,
+                         'tid': trace_id, 'args': {'sort_index': -prio}})
+        for irq, name in sorted(self.isr_names.items()):
+            meta.append({'name': 'thread_name', 'ph': 'M', 'pid': PID, 'tid': TID_ISR_BASE + irq,
+                         'args': {'name': f'ISR {name}'}})
+        if self.ticks:
+            meta.append({'name': 'thread_name', 'ph': 'M', 'pid': PID, 'tid': TID_TICK,
+                         'args': {'name': 'SysTick'}})
+
+        return {'traceEvents': meta + self.events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='调度器内核事件跟踪转换为 Chrome Trace JSON')
+    parser.add_argument('input', help='RTT 跟踪通道原始数据文件')
+    parser.add_argument('-o', '--output', help='输出 JSON 文件 (默认: 输入文件名.json)')
+    parser.add_argument('--hz', type=int, help='时间戳计数器频率 (默认取 START 记录)')
+    parser.add_argument('--no-ticks', action='store_true', help='不输出滴答轨道')
+    args = parser.parse_args()
+
+    data = Path(args.input).read_bytes()
+    conv = Converter(hz=args.hz, ticks=not args.no_ticks)
+
+    try:
+        for _, raw, ev_type, ev_id, arg, name in parse_records(data):
+            conv.feed(ev_type, ev_id, arg, name, raw)
+    except TraceError as e:
+        print(f"错误: {e}", file=sys.stderr)
+        return 1
+
+    output = Path(args.output) if args.output else Path(args.input).with_suffix('.json')
+    output.write_text(json.dumps(conv.finish()))
+
+    print(f"任务: {len(conv.tasks)}, 切换: {conv.counts.get(EV_SWITCH_IN, 0)}, "
+          f"滴答: {conv.counts.get(EV_TICK, 0)}, 丢弃事件: {conv.dropped}")
+    print(f"已写入 {output}")
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())